@@ -0,0 +1,179 @@
+#include "Workload.hpp"
+#include "ApplianceFactory.hpp"
+#include "AddressFactory.hpp"
+#include "EmployeeFactory.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <cstdio>
+#include <sys/resource.h>
+
+Workload::Workload(const WorkloadConfig& cfg)
+:   config(cfg),
+    rng(cfg.seed)
+{
+    // Cumulative brand popularity, sampled with a binary search
+    double total = 0.0;
+    for (int b = 0; b < config.brands; b++) {
+        total += (config.distribution == SkillDistribution::Zipf) ? 1.0 / (b + 1) : 1.0;
+        brand_cdf.push_back(total);
+    }
+    for (double& p : brand_cdf) p /= total;
+}
+
+const WorkloadConfig& Workload::getConfig() const { return config; }
+
+std::string Workload::brandName(int brand) {
+    return "Brand" + std::to_string(brand);
+}
+
+int Workload::pickBrand() {
+    double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+    auto it = std::lower_bound(brand_cdf.begin(), brand_cdf.end(), u);
+    return std::min<int>(it - brand_cdf.begin(), config.brands - 1);
+}
+
+std::string Workload::makeCNP(std::uint64_t index) {
+    // Spread the index over serial, county, day, month and year so every
+    // generated employee gets a distinct, well-formed CNP
+    int serial = index % 1000;
+    int county = (index / 1000) % 52 + 1;
+    int day = (index / 52000) % 28 + 1;
+    int month = (index / 1456000) % 12 + 1;
+    int year = 60 + (index / 17472000) % 40;
+    int sex = 1 + index % 2;
+
+    char digits[14];
+    std::snprintf(digits, sizeof(digits), "%d%02d%02d%02d%02d%03d0",
+                  sex, year, month, day, county, serial);
+
+    const char* weights = "279146358279";
+    int sum = 0;
+    for (int i = 0; i < 12; i++) {
+        sum += (digits[i] - '0') * (weights[i] - '0');
+    }
+    int checksum = sum % 11;
+    if (checksum == 10) checksum = 1;
+    digits[12] = static_cast<char>('0' + checksum);
+
+    return std::string(digits, 13);
+}
+
+void Workload::populateEmployees(ServiceManager& manager) {
+    using namespace std::chrono;
+    std::uint64_t index = 0;
+    std::uniform_int_distribution<int> typeDist(0, 2);
+
+    auto hired = [&]() {
+        return year_month_day{year{2015 + static_cast<int>(index % 8)}, month{1 + static_cast<unsigned>(index % 12)}, day{1}};
+    };
+    auto address = [&]() {
+        return *AddressFactory::createAddressHouse("Romania", "Bucharest", "Bucharest", "Bench", std::to_string(index));
+    };
+    // Generated ids and CNPs are unique, a rejection means the manager was not empty
+    auto hire = [&](std::unique_ptr<Employee> employee) {
+        int id = employee->getId();
+        if (!manager.addEmployee(std::move(employee))) {
+            throw std::runtime_error("Workload: the manager rejected generated employee " + std::to_string(id));
+        }
+        return id;
+    };
+
+    for (int i = 0; i < config.technicians; i++, index++) {
+        auto employee = EmployeeFactory::createTechnician(
+            "Tech", "T" + std::to_string(i), makeCNP(index), hired(), address());
+        Technician* tech = static_cast<Technician*>(employee.get());
+        for (int s = 0; s < config.skills_per_technician; s++) {
+            tech->addSkill(static_cast<ApplianceType>(typeDist(rng)), brandName(pickBrand()));
+        }
+        technician_ids.push_back(hire(std::move(employee)));
+    }
+
+    for (int i = 0; i < config.receptionists; i++, index++) {
+        auto employee = EmployeeFactory::createReceptionist(
+            "Recep", "R" + std::to_string(i), makeCNP(index), hired(), address());
+        receptionist_ids.push_back(hire(std::move(employee)));
+    }
+
+    for (int i = 0; i < config.supervisors; i++, index++) {
+        hire(EmployeeFactory::createSupervisor(
+            "Super", "S" + std::to_string(i), makeCNP(index), hired(), address()));
+    }
+}
+
+std::unique_ptr<Appliance> Workload::makeAppliance() {
+    std::uniform_int_distribution<int> typeDist(0, 2);
+    std::uniform_int_distribution<int> modelDist(0, config.models_per_brand - 1);
+    std::uniform_int_distribution<int> yearDist(config.min_year, config.max_year);
+    std::uniform_int_distribution<int> priceDist(500, 5000);
+
+    ApplianceType type = static_cast<ApplianceType>(typeDist(rng));
+    std::string brand = brandName(pickBrand());
+    std::string model = "M" + std::to_string(modelDist(rng));
+    int year = yearDist(rng);
+    int price = priceDist(rng);
+
+    switch (type) {
+        case ApplianceType::Fridge:
+            return ApplianceFactory::createApplianceFridge(brand, model, year, price, true);
+        case ApplianceType::TV:
+            return ApplianceFactory::createApplianceTV(brand, model, year, price, 55.0, DiagonalUnit::Inches);
+        case ApplianceType::WashingMachine:
+            return ApplianceFactory::createApplianceWashingMachine(brand, model, year, price, 7.0);
+    }
+    return nullptr;
+}
+
+int Workload::pickFrom(const std::vector<int>& ids) {
+    if (ids.empty()) return 0;
+    return ids[std::uniform_int_distribution<std::size_t>(0, ids.size() - 1)(rng)];
+}
+
+std::unique_ptr<RepairRequest> Workload::makeRequest(RepairRequestFactory& factory) {
+    std::unique_ptr<Appliance> appliance = makeAppliance();
+    int complexity = std::uniform_int_distribution<int>(config.min_complexity, config.max_complexity)(rng);
+    int duration = appliance->getAge() * complexity;
+
+    return factory.createRepairRequest(std::move(appliance), complexity, duration, pickFrom(receptionist_ids));
+}
+
+std::unique_ptr<RepairRequest> Workload::makeHistoricalRequest(RepairRequestFactory& factory, int id) {
+    std::unique_ptr<Appliance> appliance = makeAppliance();
+    int complexity = std::uniform_int_distribution<int>(config.min_complexity, config.max_complexity)(rng);
+    int duration = appliance->getAge() * complexity;
+    int price = appliance->getAge() * appliance->getCatalogPrice();
+
+    int roll = std::uniform_int_distribution<int>(0, 99)(rng);
+    Status status = roll < 5 ? Status::Received
+                  : roll < 35 ? Status::Pending
+                  : roll < 55 ? Status::InProgress
+                  : roll < 95 ? Status::Completed
+                  : Status::Rejected;
+
+    bool assigned = (status == Status::InProgress || status == Status::Completed);
+    int remaining = status == Status::Completed ? 0
+                  : status == Status::InProgress ? std::uniform_int_distribution<int>(0, duration)(rng)
+                  : duration;
+    auto received = ServiceManager::getInstance().getClock().now()
+                  - std::chrono::hours{std::uniform_int_distribution<int>(0, 24 * 365)(rng)};
+
+    return factory.createRepairRequestFromCSV(
+        id, std::move(appliance), received, complexity, duration, remaining, price, status,
+        pickFrom(receptionist_ids), assigned ? pickFrom(technician_ids) : 0);
+}
+
+int Workload::nextArrivals() {
+    if (config.arrival_rate <= 0.0) return 0;
+    return std::poisson_distribution<int>(config.arrival_rate)(rng);
+}
+
+bool parseSkillDistribution(const std::string& name, SkillDistribution& out) {
+    if (name == "uniform") { out = SkillDistribution::Uniform; return true; }
+    if (name == "zipf") { out = SkillDistribution::Zipf; return true; }
+    return false;
+}
+
+long peakRSSKilobytes() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;  // Kilobytes on Linux
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "ServiceManager.hpp"
+#include "RepairRequestFactory.hpp"
+
+// ============================================================================
+// SYNTHETIC WORKLOAD GENERATOR (benchmarks only)
+// ============================================================================
+
+enum class SkillDistribution {
+    Uniform,  // Every brand equally likely
+    Zipf      // A few popular brands, long tail (s = 1)
+};
+
+struct WorkloadConfig {
+    int technicians = 50;
+    int receptionists = 5;
+    int supervisors = 2;
+    int skills_per_technician = 4;
+    SkillDistribution distribution = SkillDistribution::Zipf;
+    int brands = 20;               // Brand cardinality
+    int models_per_brand = 5;
+    double arrival_rate = 5.0;     // Mean new requests per tick (Poisson)
+    int min_complexity = 1;
+    int max_complexity = 5;
+    int min_year = 2010;           // Appliance age drives the repair duration
+    int max_year = 2023;
+    std::uint64_t seed = 42;
+};
+
+// Deterministic for a given config: same seed, same employees, same requests
+class Workload {
+private:
+    WorkloadConfig config;
+    std::mt19937_64 rng;
+    std::vector<double> brand_cdf;
+    std::vector<int> receptionist_ids;
+    std::vector<int> technician_ids;
+
+    int pickBrand();
+    int pickFrom(const std::vector<int>& ids);
+    std::unique_ptr<Appliance> makeAppliance();
+
+public:
+    explicit Workload(const WorkloadConfig& config);
+
+    static std::string brandName(int brand);
+    // Unique, checksum-valid CNP for the i-th generated employee
+    static std::string makeCNP(std::uint64_t index);
+
+    // Adds the configured staff to the manager
+    void populateEmployees(ServiceManager& manager);
+
+    // One freshly received request
+    std::unique_ptr<RepairRequest> makeRequest(RepairRequestFactory& factory);
+    // A request as it would be found in a saved file, in any status:
+    // 5% received, 30% pending, 20% in progress, 40% completed, 5% rejected
+    std::unique_ptr<RepairRequest> makeHistoricalRequest(RepairRequestFactory& factory, int id);
+    // Number of requests arriving during the next tick
+    int nextArrivals();
+
+    const WorkloadConfig& getConfig() const;
+};
+
+// Shared by the benchmark binaries
+bool parseSkillDistribution(const std::string& name, SkillDistribution& out);
+long peakRSSKilobytes();
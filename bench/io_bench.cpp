@@ -0,0 +1,245 @@
+// Microbenchmarks for CSV persistence, report generation and CNP validation.
+// For every dataset size a deterministic service is generated and saved in
+// the regular CSV schemas, then each operation is run with warmup and
+// repetitions. Results go out as CSV (default) or JSON, one record per
+// (operation, size), so runs from different commits can be diffed.
+//
+//   make bench-io BENCH_IO_ARGS="--sizes 10000,100000 --format json"
+
+#include "Workload.hpp"
+#include "CNPValidator.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    struct BenchOptions {
+        std::vector<int> sizes{10000, 100000, 1000000};
+        int employees_per_1000 = 20;   // Staff size relative to the request count, ~50 requests each
+        int warmup = 1;
+        int repetitions = 5;
+        bool json = false;
+        std::string output;            // Empty means stdout
+        std::string dir = (std::filesystem::temp_directory_path() / "fixitnow_bench").string();
+        std::uint64_t seed = 42;
+    };
+
+    struct Result {
+        std::string operation;
+        int rows;
+        int employees;
+        std::vector<double> samples_ms;
+    };
+
+    void printUsage() {
+        std::cerr <<
+            "Usage: bench_io [options]\n"
+            "  --sizes N,N,...        request rows per dataset (default 10000,100000,1000000)\n"
+            "  --employees-per-1000 N employees per 1000 requests (default 20; total staff is at least 50)\n"
+            "  --warmup N             unmeasured runs per operation (default 1)\n"
+            "  --repetitions N        measured runs per operation (default 5)\n"
+            "  --format csv|json      output format (default csv)\n"
+            "  --output FILE          write results to FILE instead of stdout\n"
+            "  --dir DIR              where datasets and reports are written\n"
+            "  --seed N               generator seed (default 42)\n";
+    }
+
+    bool parseArgs(int argc, char* argv[], BenchOptions& options) {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            if (i + 1 >= argc) return false;
+            std::string value = argv[++i];
+
+            if (arg == "--sizes") {
+                options.sizes.clear();
+                std::istringstream list(value);
+                std::string item;
+                while (std::getline(list, item, ',')) {
+                    options.sizes.push_back(std::stoi(item));
+                }
+            }
+            else if (arg == "--employees-per-1000") options.employees_per_1000 = std::stoi(value);
+            else if (arg == "--warmup") options.warmup = std::stoi(value);
+            else if (arg == "--repetitions") options.repetitions = std::stoi(value);
+            else if (arg == "--format") {
+                if (value != "csv" && value != "json") return false;
+                options.json = (value == "json");
+            }
+            else if (arg == "--output") options.output = value;
+            else if (arg == "--dir") options.dir = value;
+            else if (arg == "--seed") options.seed = std::stoull(value);
+            else return false;
+        }
+        return !options.sizes.empty() && options.repetitions > 0 && options.warmup >= 0;
+    }
+
+    double median(std::vector<double> values) {
+        std::sort(values.begin(), values.end());
+        std::size_t mid = values.size() / 2;
+        return values.size() % 2 ? values[mid] : (values[mid - 1] + values[mid]) / 2.0;
+    }
+
+    double mean(const std::vector<double>& values) {
+        double total = 0.0;
+        for (double v : values) total += v;
+        return total / values.size();
+    }
+
+    // Runs setup (untimed) and op (timed) warmup + repetitions times
+    std::vector<double> measure(int warmup, int repetitions,
+                                const std::function<void()>& setup,
+                                const std::function<void()>& op) {
+        std::vector<double> samples;
+        for (int run = 0; run < warmup + repetitions; run++) {
+            setup();
+            auto start = std::chrono::steady_clock::now();
+            op();
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            if (run >= warmup) {
+                samples.push_back(std::chrono::duration<double, std::milli>(elapsed).count());
+            }
+        }
+        return samples;
+    }
+
+    void writeResults(std::ostream& out, const std::vector<Result>& results, bool json) {
+        if (json) {
+            out << "[\n";
+            for (std::size_t i = 0; i < results.size(); i++) {
+                const Result& r = results[i];
+                const auto [min, max] = std::minmax_element(r.samples_ms.begin(), r.samples_ms.end());
+                out << "  {\"operation\":\"" << r.operation << "\",\"rows\":" << r.rows
+                    << ",\"employees\":" << r.employees << ",\"repetitions\":" << r.samples_ms.size()
+                    << ",\"min_ms\":" << *min << ",\"median_ms\":" << median(r.samples_ms)
+                    << ",\"mean_ms\":" << mean(r.samples_ms) << ",\"max_ms\":" << *max
+                    << ",\"rows_per_sec\":" << r.rows / (median(r.samples_ms) / 1000.0) << "}"
+                    << (i + 1 < results.size() ? ",\n" : "\n");
+            }
+            out << "]\n";
+            return;
+        }
+
+        out << "operation,rows,employees,repetitions,min_ms,median_ms,mean_ms,max_ms,rows_per_sec\n";
+        for (const Result& r : results) {
+            const auto [min, max] = std::minmax_element(r.samples_ms.begin(), r.samples_ms.end());
+            out << r.operation << "," << r.rows << "," << r.employees << "," << r.samples_ms.size()
+                << "," << *min << "," << median(r.samples_ms) << "," << mean(r.samples_ms)
+                << "," << *max << "," << r.rows / (median(r.samples_ms) / 1000.0) << "\n";
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    try {
+        if (!parseArgs(argc, argv, options)) {
+            printUsage();
+            return 1;
+        }
+    } catch (const std::exception&) {
+        printUsage();
+        return 1;
+    }
+
+    std::filesystem::create_directories(options.dir);
+    const std::string employeesFile = options.dir + "/Employees.csv";
+    const std::string requestsFile = options.dir + "/RepairRequests.csv";
+    const std::string savedEmployees = options.dir + "/Employees_saved.csv";
+    const std::string savedRequests = options.dir + "/RepairRequests_saved.csv";
+
+    // The manager reports every load, save and report on stdout
+    std::ostringstream discarded;
+    std::streambuf* stdoutBuffer = std::cout.rdbuf(discarded.rdbuf());
+    auto quiet = [&discarded]() { discarded.str({}); };
+
+    ServiceManager& manager = ServiceManager::getInstance();
+    using namespace std::chrono;
+    // Frozen clock: salaries, ages and bonuses come out the same on every run
+    manager.getClock().freeze(sys_days{year{2024} / June / 1});
+
+    RepairRequestFactory factory(1);
+    std::vector<Result> results;
+
+    for (int rows : options.sizes) {
+        // Generate the dataset and save it in the regular schemas
+        WorkloadConfig config;
+        config.seed = options.seed;
+        int staff = std::max(50, static_cast<int>(static_cast<long long>(rows) * options.employees_per_1000 / 1000));
+        config.technicians = staff * 8 / 10;
+        config.receptionists = staff / 10;
+        config.supervisors = staff - config.technicians - config.receptionists;
+
+        std::cerr << "Generating " << rows << " requests, " << staff << " employees...\n";
+        manager.clear();
+        Workload workload(config);
+        workload.populateEmployees(manager);
+        for (int id = 1; id <= rows; id++) {
+            manager.addRepairRequest(workload.makeHistoricalRequest(factory, id));
+        }
+        manager.saveToCSV(employeesFile, requestsFile);
+        quiet();
+
+        auto run = [&](const std::string& name, const std::function<void()>& setup, const std::function<void()>& op) {
+            std::cerr << "  " << name << " @ " << rows << "\n";
+            results.push_back({name, rows, staff, measure(options.warmup, options.repetitions, setup, op)});
+            quiet();
+        };
+        auto reload = [&]() { manager.clear(); manager.loadFromCSV(factory, employeesFile, requestsFile); };
+
+        run("loadFromCSV", [&]() { manager.clear(); },
+            [&]() { manager.loadFromCSV(factory, employeesFile, requestsFile); });
+
+        // Everything below works on the freshly loaded state
+        reload();
+        run("saveToCSV", []() {}, [&]() { manager.saveToCSV(savedEmployees, savedRequests); });
+        run("generateTop3SalariesReport", []() {},
+            [&]() { manager.generateTop3SalariesReport(options.dir + "/top3_salaries.csv"); });
+        run("generateLongestRepairReport", []() {},
+            [&]() { manager.generateLongestRepairReport(options.dir + "/longest_repair.csv"); });
+        run("generatePendingRequestsReport", []() {},
+            [&]() { manager.generatePendingRequestsReport(options.dir + "/pending_requests.csv"); });
+
+        // CNP validation over `rows` identity numbers, one in ten corrupted
+        std::vector<std::string> cnps;
+        std::string packed;
+        cnps.reserve(rows);
+        for (int i = 0; i < rows; i++) {
+            std::string cnp = Workload::makeCNP(i);
+            if (i % 10 == 0) {
+                std::size_t pos = i % CNPValidator::LENGTH;
+                cnp[pos] = (i % 20 == 0) ? 'x' : '0' + (cnp[pos] - '0' + 1) % 10;
+            }
+            cnps.push_back(cnp);
+            packed += cnp;
+        }
+        std::vector<CNPError> errors(rows);
+        std::size_t validCount = 0;
+
+        run("CNPValidator::isValid", [&]() { validCount = 0; },
+            [&]() { for (const auto& cnp : cnps) validCount += CNPValidator::isValid(cnp); });
+        run("CNPValidator::validateBatch", []() {},
+            [&]() { CNPValidator::validateBatch(packed.data(), rows, errors.data()); });
+        std::cerr << "  (" << validCount << " valid of " << rows << ")\n";
+    }
+
+    std::cout.rdbuf(stdoutBuffer);
+
+    if (options.output.empty()) {
+        writeResults(std::cout, results, options.json);
+    } else {
+        std::ofstream out(options.output);
+        if (!out.is_open()) {
+            std::cerr << "Error: Could not open " << options.output << " for writing.\n";
+            return 1;
+        }
+        writeResults(out, results, options.json);
+    }
+
+    return 0;
+}
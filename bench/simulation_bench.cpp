@@ -0,0 +1,321 @@
+// Throughput benchmark for the simulation loop (ServiceManager::tick).
+// Builds a synthetic service, feeds it Poisson arrivals and reports
+// ticks/sec, assignments/sec, tick latency percentiles, request wait times
+// and peak RSS. With --policy all, every scheduling policy is run on the
+// same workload and compared side by side.
+//
+//   make bench BENCH_ARGS="--technicians 200 --brands 50 --arrival 20"
+//   make bench BENCH_ARGS="--policy all --arrival 12"
+//   make bench BENCH_ARGS="--assign batch --budget-us 500 --arrival 12"
+
+#include "Workload.hpp"
+#include "LatencyHistogram.hpp"
+#include "Profiler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    struct BenchOptions {
+        WorkloadConfig workload;
+        int ticks = 2000;
+        int warmup = 200;
+        bool json = false;
+        std::vector<SchedulingPolicyKind> policies{SchedulingPolicyKind::FirstCome};
+        AssignmentMode assignment = AssignmentMode::Greedy;
+        long long budget_us = 2000;
+    };
+
+    struct RunResult {
+        SchedulingPolicyKind policy;
+        double ticks_per_sec = 0;
+        double assignments_per_sec = 0;
+        double completed_per_tick = 0;
+        LatencyHistogram latency;
+        std::vector<int> waits;  // Ticks from arrival to assignment, measured requests only
+        ServiceStats stats;
+
+        int waitPercentile(double p) const {
+            if (waits.empty()) return 0;
+            std::size_t rank = static_cast<std::size_t>(p / 100.0 * (waits.size() - 1));
+            return waits[rank];
+        }
+    };
+
+    void printUsage() {
+        std::cerr <<
+            "Usage: bench_simulation [options]\n"
+            "  --technicians N      technicians on staff (default 50)\n"
+            "  --skills N           skills per technician (default 4)\n"
+            "  --skill-dist D       uniform | zipf brand popularity (default zipf)\n"
+            "  --brands N           brand cardinality (default 20)\n"
+            "  --models N           models per brand (default 5)\n"
+            "  --arrival R          mean new requests per tick (default 5)\n"
+            "  --complexity LO-HI   complexity range (default 1-5)\n"
+            "  --ticks N            measured ticks (default 2000)\n"
+            "  --warmup N           unmeasured ticks before measuring (default 200)\n"
+            "  --seed N             generator seed (default 42)\n"
+            "  --policy P           first-come | shortest-repair | highest-price | aging |\n"
+            "                       fair-share | all (default first-come)\n"
+            "  --assign M           greedy | batch (default greedy)\n"
+            "  --budget-us N        batch matching budget per tick (default 2000)\n"
+            "  --json               print one JSON object instead of a table\n";
+    }
+
+    bool parseArgs(int argc, char* argv[], BenchOptions& options) {
+        WorkloadConfig& w = options.workload;
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            bool hasValue = i + 1 < argc;
+            std::string value = hasValue ? argv[i + 1] : "";
+
+            if (arg == "--json") { options.json = true; continue; }
+            if (!hasValue) return false;
+            i++;
+
+            if (arg == "--technicians") w.technicians = std::stoi(value);
+            else if (arg == "--skills") w.skills_per_technician = std::stoi(value);
+            else if (arg == "--skill-dist") { if (!parseSkillDistribution(value, w.distribution)) return false; }
+            else if (arg == "--brands") w.brands = std::stoi(value);
+            else if (arg == "--models") w.models_per_brand = std::stoi(value);
+            else if (arg == "--arrival") w.arrival_rate = std::stod(value);
+            else if (arg == "--complexity") {
+                std::size_t dash = value.find('-');
+                if (dash == std::string::npos) return false;
+                w.min_complexity = std::stoi(value.substr(0, dash));
+                w.max_complexity = std::stoi(value.substr(dash + 1));
+            }
+            else if (arg == "--ticks") options.ticks = std::stoi(value);
+            else if (arg == "--warmup") options.warmup = std::stoi(value);
+            else if (arg == "--seed") w.seed = std::stoull(value);
+            else if (arg == "--assign") {
+                if (value == "greedy") options.assignment = AssignmentMode::Greedy;
+                else if (value == "batch") options.assignment = AssignmentMode::Batch;
+                else return false;
+            }
+            else if (arg == "--budget-us") options.budget_us = std::stoll(value);
+            else if (arg == "--policy") {
+                if (value == "all") {
+                    options.policies = SchedulingPolicy::allKinds();
+                } else {
+                    std::optional<SchedulingPolicyKind> kind = SchedulingPolicy::parseKind(value);
+                    if (!kind) return false;
+                    options.policies = {*kind};
+                }
+            }
+            else return false;
+        }
+        return w.brands > 0 && w.models_per_brand > 0 && w.min_complexity >= 1 &&
+               w.min_complexity <= w.max_complexity && options.ticks > 0 && options.budget_us > 0;
+    }
+
+    // Runs the whole workload from an empty manager under one policy
+    RunResult run(const BenchOptions& options, SchedulingPolicyKind policy) {
+        using namespace std::chrono;
+
+        ServiceManager& manager = ServiceManager::getInstance();
+        manager.clear();
+        manager.getClock().setSimulated(sys_days{year{2024} / January / 1});
+        manager.setSchedulingPolicy(SchedulingPolicy::create(policy));
+        manager.setAssignmentMode(options.assignment, std::chrono::microseconds{options.budget_us});
+
+        RepairRequestFactory factory(1);
+        Workload workload(options.workload);
+        workload.populateEmployees(manager);
+
+        // The manager logs every assignment to stdout; keep that out of the numbers
+        std::ostringstream discarded;
+        std::streambuf* stdoutBuffer = std::cout.rdbuf(discarded.rdbuf());
+
+        RunResult result;
+        result.policy = policy;
+        long long assignmentsBefore = 0;
+        std::size_t completedBefore = 0;
+        steady_clock::duration measured{};
+        std::vector<std::pair<RepairRequest*, int>> waiting;  // (request, arrival tick)
+
+        for (int t = 0; t < options.warmup + options.ticks; t++) {
+            if (t == options.warmup) {
+                ServiceStats before = manager.getStats();
+                assignmentsBefore = before.assignments;
+                completedBefore = before.requests_by_status[static_cast<std::size_t>(Status::Completed)];
+                Profiler::getInstance().reset();
+            }
+
+            int arrivals = workload.nextArrivals();
+            for (int a = 0; a < arrivals; a++) {
+                auto request = workload.makeRequest(factory);
+                waiting.emplace_back(request.get(), t);
+                manager.addRepairRequest(std::move(request));
+            }
+
+            auto start = steady_clock::now();
+            manager.tick();
+            auto elapsed = steady_clock::now() - start;
+
+            if (t >= options.warmup) {
+                result.latency.record(duration_cast<nanoseconds>(elapsed));
+                measured += elapsed;
+            }
+
+            // Outside the timed region: note when waiting requests got a technician
+            std::erase_if(waiting, [&](const std::pair<RepairRequest*, int>& entry) {
+                Status status = entry.first->getStatus();
+                if (status == Status::Received || status == Status::Pending) return false;
+                if (status != Status::Rejected && t >= options.warmup) {
+                    result.waits.push_back(t - entry.second);
+                }
+                return true;
+            });
+
+            // Keep the discarded log from growing for the whole run
+            if ((t & 63) == 0) discarded.str({});
+        }
+
+        std::cout.rdbuf(stdoutBuffer);
+
+        result.stats = manager.getStats();
+        double seconds = duration<double>(measured).count();
+        result.ticks_per_sec = options.ticks / seconds;
+        result.assignments_per_sec = (result.stats.assignments - assignmentsBefore) / seconds;
+        result.completed_per_tick = static_cast<double>(
+            result.stats.requests_by_status[static_cast<std::size_t>(Status::Completed)] - completedBefore) / options.ticks;
+        std::sort(result.waits.begin(), result.waits.end());
+        return result;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    try {
+        if (!parseArgs(argc, argv, options)) {
+            printUsage();
+            return 1;
+        }
+    } catch (const std::exception&) {
+        printUsage();
+        return 1;
+    }
+
+    std::vector<RunResult> results;
+    for (SchedulingPolicyKind policy : options.policies) {
+        results.push_back(run(options, policy));
+    }
+
+    using namespace std::chrono;
+    auto us = [](nanoseconds ns) { return duration<double, std::micro>(ns).count(); };
+    const char* distribution = options.workload.distribution == SkillDistribution::Zipf ? "zipf" : "uniform";
+    const char* assignment = options.assignment == AssignmentMode::Batch ? "batch" : "greedy";
+    // Phases and counters are only shown for the last run
+    const ProfileSnapshot& profile = Profiler::getInstance().getSnapshot();
+
+    if (options.json) {
+        // One object per policy, one per line
+        for (const RunResult& r : results) {
+            std::cout << "{\"benchmark\":\"simulation\""
+                      << ",\"policy\":\"" << SchedulingPolicy::kindName(r.policy) << "\""
+                      << ",\"assign\":\"" << assignment << "\""
+                      << ",\"technicians\":" << options.workload.technicians
+                      << ",\"skills\":" << options.workload.skills_per_technician
+                      << ",\"skill_dist\":\"" << distribution << "\""
+                      << ",\"brands\":" << options.workload.brands
+                      << ",\"arrival\":" << options.workload.arrival_rate
+                      << ",\"ticks\":" << options.ticks
+                      << ",\"ticks_per_sec\":" << r.ticks_per_sec
+                      << ",\"assignments_per_sec\":" << r.assignments_per_sec
+                      << ",\"completed_per_tick\":" << r.completed_per_tick
+                      << ",\"p50_us\":" << us(r.latency.percentile(50))
+                      << ",\"p99_us\":" << us(r.latency.percentile(99))
+                      << ",\"max_us\":" << us(r.latency.getMax())
+                      << ",\"wait_p50_ticks\":" << r.waitPercentile(50)
+                      << ",\"wait_p99_ticks\":" << r.waitPercentile(99)
+                      << ",\"wait_max_ticks\":" << r.waitPercentile(100)
+                      << ",\"requests\":" << r.stats.total_requests
+                      << ",\"pending\":" << r.stats.requests_by_status[static_cast<std::size_t>(Status::Pending)]
+                      << ",\"batch_timeouts\":" << r.stats.batch_timeouts
+                      << ",\"peak_rss_kb\":" << peakRSSKilobytes();
+            if (Profiler::isEnabled() && results.size() == 1) {
+                for (std::size_t i = 0; i < profile.phases.size(); i++) {
+                    const char* name = Profiler::phaseName(static_cast<ProfilePhase>(i));
+                    std::cout << ",\"" << name << "_p50_us\":" << us(profile.phases[i].percentile(50))
+                              << ",\"" << name << "_p99_us\":" << us(profile.phases[i].percentile(99));
+                }
+                for (std::size_t i = 0; i < profile.counters.size(); i++) {
+                    std::cout << ",\"" << Profiler::counterName(static_cast<ProfileCounter>(i)) << "\":" << profile.counters[i];
+                }
+            }
+            std::cout << "}\n";
+        }
+        return 0;
+    }
+
+    std::cout << "=== Simulation benchmark ===\n"
+              << "technicians=" << options.workload.technicians
+              << " skills=" << options.workload.skills_per_technician
+              << " skill_dist=" << distribution
+              << " brands=" << options.workload.brands
+              << " arrival=" << options.workload.arrival_rate
+              << " complexity=" << options.workload.min_complexity << "-" << options.workload.max_complexity
+              << " seed=" << options.workload.seed
+              << " assign=" << assignment;
+    if (options.assignment == AssignmentMode::Batch) std::cout << " budget_us=" << options.budget_us;
+    std::cout << "\n"
+              << "ticks measured:   " << options.ticks << " (after " << options.warmup << " warmup)\n";
+
+    if (results.size() > 1) {
+        std::cout << std::left << std::setw(17) << "policy" << std::right
+                  << std::setw(11) << "ticks/s" << std::setw(11) << "assign/s" << std::setw(11) << "done/tick"
+                  << std::setw(11) << "tick p99" << std::setw(10) << "wait p50" << std::setw(10) << "wait p99"
+                  << std::setw(10) << "wait max" << std::setw(9) << "pending" << "\n";
+        for (const RunResult& r : results) {
+            std::cout << std::left << std::setw(17) << SchedulingPolicy::kindName(r.policy) << std::right
+                      << std::fixed << std::setprecision(0)
+                      << std::setw(11) << r.ticks_per_sec << std::setw(11) << r.assignments_per_sec
+                      << std::setprecision(2) << std::setw(11) << r.completed_per_tick
+                      << std::setprecision(1) << std::setw(11) << us(r.latency.percentile(99))
+                      << std::setw(10) << r.waitPercentile(50) << std::setw(10) << r.waitPercentile(99)
+                      << std::setw(10) << r.waitPercentile(100)
+                      << std::setw(9) << r.stats.requests_by_status[static_cast<std::size_t>(Status::Pending)] << "\n";
+        }
+        std::cout << "(tick p99 in us, waits in ticks from arrival to assignment)\n";
+        return 0;
+    }
+
+    const RunResult& r = results.front();
+    std::cout << "policy:           " << SchedulingPolicy::kindName(r.policy) << "\n"
+              << "ticks/sec:        " << r.ticks_per_sec << "\n"
+              << "assignments/sec:  " << r.assignments_per_sec << "\n"
+              << "completed/tick:   " << r.completed_per_tick << "\n"
+              << "tick p50:         " << us(r.latency.percentile(50)) << " us\n"
+              << "tick p99:         " << us(r.latency.percentile(99)) << " us\n"
+              << "tick max:         " << us(r.latency.getMax()) << " us\n"
+              << "wait p50/p99/max: " << r.waitPercentile(50) << " / " << r.waitPercentile(99)
+              << " / " << r.waitPercentile(100) << " ticks\n"
+              << "requests:         " << r.stats.total_requests
+              << " (pending " << r.stats.requests_by_status[static_cast<std::size_t>(Status::Pending)]
+              << ", rejected " << r.stats.requests_by_status[static_cast<std::size_t>(Status::Rejected)] << ")\n"
+              << "batch timeouts:   " << r.stats.batch_timeouts << "\n"
+              << "peak RSS:         " << peakRSSKilobytes() << " KB\n";
+
+    if (Profiler::isEnabled()) {
+        std::cout << "--- phases (p50 / p99 / mean, us) ---\n";
+        for (std::size_t i = 0; i < profile.phases.size(); i++) {
+            const LatencyHistogram& h = profile.phases[i];
+            std::cout << "  " << Profiler::phaseName(static_cast<ProfilePhase>(i)) << ": "
+                      << us(h.percentile(50)) << " / " << us(h.percentile(99)) << " / " << us(h.getMean()) << "\n";
+        }
+        std::cout << "--- counters per tick ---\n";
+        for (std::size_t i = 0; i < profile.counters.size(); i++) {
+            std::cout << "  " << Profiler::counterName(static_cast<ProfileCounter>(i)) << ": "
+                      << static_cast<double>(profile.counters[i]) / options.ticks << "\n";
+        }
+    }
+
+    return 0;
+}
@@ -24,6 +24,8 @@ enum class ApplianceType {
     WashingMachine
 };
 
+constexpr std::size_t APPLIANCE_TYPE_COUNT = 3;
+
 // Convert string to enum
 ApplianceType stringToApplianceType(const std::string& str);
 
@@ -38,6 +40,7 @@ class Appliance {
 protected:
     ApplianceType type;           // Fridge/TV/WashingMachine
     std::string brand;            // "Samsung", "LG"
+    mutable int brand_id;         // BrandRegistry id, UNREGISTERED_BRAND until known
     std::string model;            // "Frost200", "SmartTV55"
     int year_of_manufacture;      // 2020
     int catalog_price;            // 1500
@@ -55,10 +58,17 @@ protected:
 public:
     virtual ~Appliance() = default;
     
+    static constexpr int UNREGISTERED_BRAND = -1;
+
     // Getters
     ApplianceType getType() const;
-    std::string getBrand() const;
-    std::string getModel() const;
+    const std::string& getBrand() const;
+    // Looks the brand up without registering it, so appliances that are
+    // never stored leave the registry alone
+    int getBrandId() const;
+    // Called when the appliance is stored in the manager
+    void registerBrand() const;
+    const std::string& getModel() const;
     int getYear() const;
     int getCatalogPrice() const;
     
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <optional>
+
+// ============================================================================
+// BRAND REGISTRY
+// ============================================================================
+
+// Interns brand names into small dense ids (0, 1, 2, ...) so that skills and
+// appliances can be compared by integer instead of by string. Ids are never
+// reused. Brands are case-sensitive, as they always were.
+class BrandRegistry {
+private:
+    static std::mutex mutex;
+    static std::map<std::string, int, std::less<>> ids;
+    static std::deque<std::string> names;  // Indexed by id; deque keeps references stable
+
+    BrandRegistry() = delete;
+
+public:
+    static int intern(std::string_view brand);
+    static std::optional<int> find(std::string_view brand);
+    static const std::string& name(int id);
+    static std::size_t size();
+};
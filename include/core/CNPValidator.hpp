@@ -1,29 +1,66 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
-#include <algorithm>
-#include <cctype>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+// Result of a CNP check, in the order the checks are applied
+enum class CNPError : std::uint8_t {
+    None,
+    Length,
+    NonDigit,
+    Sex,
+    Year,
+    Month,
+    Day,
+    County,
+    Checksum
+};
+
+// Everything validate() learns about a CNP in its single pass. The decoded
+// fields are filled in as far as the checks got, so a CNP failing only its
+// checksum still reports its birth date, sex digit and county.
+struct CNPInfo {
+    CNPError error = CNPError::Length;
+    std::chrono::year_month_day birth_date{};
+    int sex = 0;      // First digit, 1-9
+    int county = 0;   // 01-52
+
+    bool isValid() const { return error == CNPError::None; }
+};
 
 class CNPValidator {
 public:
+    static constexpr std::size_t LENGTH = 13;
+
+    // Single pass: length, digits, sex, birth date, county, then checksum
+    static CNPInfo validate(std::string_view cnp);
+
     static bool isValid(const std::string& cnp);
     static std::string getValidationError(const std::string& cnp);
+
+    // Batch validation for bulk imports. `records` holds `count` CNPs of
+    // exactly 13 digits back to back (no separators); one error code is
+    // written per record. Digits and checksums are checked with SIMD where
+    // available.
+    static void validateBatch(const char* records, std::size_t count, CNPError* errors);
+    static std::vector<CNPError> validateBatch(const std::vector<std::string>& cnps);
+    static const char* errorMessage(CNPError error);
+
+    // Fixed-width key for hashing: the 13 digits read as one decimal number
+    // (at most 44 bits). Empty unless the CNP is exactly 13 digits.
+    static std::optional<std::uint64_t> packKey(std::string_view cnp);
     
 private:
-    static bool hasValidLength(const std::string& cnp);
-    static bool hasOnlyDigits(const std::string& cnp);
-    static bool hasValidSex(const std::string& cnp);
-    static bool hasValidYear(const std::string& cnp);
-    static bool hasValidMonth(const std::string& cnp);
-    static bool hasValidDay(const std::string& cnp);
-    static bool hasValidCounty(const std::string& cnp);
-    static bool hasValidChecksum(const std::string& cnp);
-    
-    static int extractYear(const std::string& cnp);
-    static int extractMonth(const std::string& cnp);
-    static int extractDay(const std::string& cnp);
+    // Decodes 13 characters known to be digits, checksum excluded
+    static CNPError checkFields(const char* digits, CNPInfo& info);
+    static int weightedSum(const char* digits);
+    static bool checksumMatches(const char* digits, int weighted_sum);
     
     static bool isLeapYear(int year);
     static int getDaysInMonth(int month, int year);
-};
\ No newline at end of file
+};
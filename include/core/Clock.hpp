@@ -0,0 +1,48 @@
+#pragma once
+
+#include <chrono>
+
+// ============================================================================
+// CLOCK MODE ENUM
+// ============================================================================
+
+enum class ClockMode {
+    RealTime,       // Follows std::chrono::system_clock
+    SimulatedTick,  // Starts at an origin and advances a fixed step per tick
+    Frozen          // Always returns the same time point
+};
+
+// ============================================================================
+// CLOCK CLASS
+// ============================================================================
+
+// Time source owned by the ServiceManager. Everything that needs "now"
+// (timestamps, seniority, monthly bonuses, appliance age) reads it from here
+// so that simulations can be replayed deterministically.
+class Clock {
+private:
+    ClockMode mode;
+    std::chrono::system_clock::time_point origin;
+    std::chrono::system_clock::duration tick_length;
+    long long ticks;
+
+public:
+    Clock();
+
+    // Mode switches
+    void setRealTime();
+    void setSimulated(std::chrono::system_clock::time_point start,
+                      std::chrono::system_clock::duration step = std::chrono::hours{1});
+    void freeze(std::chrono::system_clock::time_point at);
+    void freeze();  // Freezes at the current reading
+
+    // Called once per simulation tick
+    void advance(long long count = 1);
+
+    // Getters
+    std::chrono::system_clock::time_point now() const;
+    std::chrono::year_month_day today() const;
+    ClockMode getMode() const;
+    long long getTickCount() const;
+    std::chrono::system_clock::duration getTickLength() const;
+};
@@ -14,6 +14,8 @@ enum class EmployeeType{
     Supervisor
 };
 
+constexpr std::size_t EMPLOYEE_TYPE_COUNT = 3;
+
 // ============================================================================
 // BASE EMPLOYEE CLASS
 // ============================================================================
@@ -26,9 +28,14 @@ protected:
     std::string CNP;
     std::chrono::year_month_day date_of_hiring;
     Address residence;
-    int salary;
     EmployeeType type;
 
+    // Salary cache, refreshed lazily when the clock moves to another day
+    // and right away when something the salary depends on changes
+    mutable int salary;
+    mutable std::chrono::year_month_day salary_computed_on;
+    mutable bool salary_valid;
+
     static const int BASE_SALARY = 4000;
     static const int TRANSPORT_BONUS = 400;
 
@@ -37,7 +44,12 @@ protected:
         std::string CNP, std::chrono::year_month_day date_of_hiring,
         Address residence, EmployeeType type);
 
+    // Salary formula, overridden by the derived classes
+    virtual int computeSalary() const;
+    void refreshSalary() const;
+
 public:
+    virtual ~Employee() = default;
     
     int getNumYearsWorked() const;
 
@@ -46,7 +58,7 @@ public:
     int calculateTransportBonus() const;
 
     //Getters
-    virtual int getSalary() const;
+    int getSalary() const;
     int getId() const;
     const std::string& getFirstName() const;
     const std::string& getLastName() const;
@@ -56,8 +68,10 @@ public:
     const Address& getResidence() const;
 
     //Setters
-    virtual void setSalary();
+    void setSalary();
+    void invalidateSalary();
 
     void changeFirstName(std::string new_first_name);
     void changeLastName(std::string new_last_name);
+    void changeDateOfHiring(std::chrono::year_month_day new_date_of_hiring);
 };
\ No newline at end of file
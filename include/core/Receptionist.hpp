@@ -24,6 +24,6 @@ public:
     void addReceivedRepairRequest(int new_received_repair_request);
 
     //Getters
-    std::vector<int> getReceivedRepairRequests();
+    const std::vector<int>& getReceivedRepairRequests() const;
 
 };
\ No newline at end of file
@@ -18,6 +18,8 @@ enum class Status{
     Rejected
 };
 
+constexpr std::size_t STATUS_COUNT = 5;
+
 // ============================================================================
 // BASE EMPLOYEE CLASS
 // ============================================================================
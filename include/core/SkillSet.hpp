@@ -0,0 +1,64 @@
+#pragma once
+
+#include <vector>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+#include <bit>
+
+#include "Appliance.hpp"
+
+// ============================================================================
+// SKILL SET
+// ============================================================================
+
+// Bitset over (appliance type x interned brand id). Bit
+// brand_id * APPLIANCE_TYPE_COUNT + type is set when the skill is present,
+// so checking a skill is a single bit test and comparing whole skill sets
+// is a word-wise AND.
+class SkillSet {
+private:
+    std::vector<std::uint64_t> words;
+
+public:
+    // Dense index of one skill, also usable as a bucket key elsewhere
+    static std::size_t bitIndex(ApplianceType type, int brand_id) {
+        return static_cast<std::size_t>(brand_id) * APPLIANCE_TYPE_COUNT + static_cast<std::size_t>(type);
+    }
+    // The appliance's brand must be registered (true for stored requests)
+    static std::size_t bitIndex(const Appliance& appliance) {
+        return bitIndex(appliance.getType(), appliance.getBrandId());
+    }
+
+    void add(ApplianceType type, int brand_id);
+    void add(ApplianceType type, std::string_view brand);  // Interns the brand
+    void addAll(const SkillSet& other);
+    void clear();
+
+    bool contains(std::size_t bit) const {
+        std::size_t word = bit / 64;
+        return word < words.size() && ((words[word] >> (bit % 64)) & 1u);
+    }
+    bool contains(ApplianceType type, int brand_id) const {
+        return contains(bitIndex(type, brand_id));
+    }
+
+    bool contains(const Appliance& appliance) const {
+        int brand_id = appliance.getBrandId();
+        return brand_id != Appliance::UNREGISTERED_BRAND && contains(appliance.getType(), brand_id);
+    }
+
+    bool containsAll(const SkillSet& other) const;
+    bool intersects(const SkillSet& other) const;
+    bool empty() const;
+
+    // Calls f(bit index) for every skill in the set
+    template <typename F>
+    void forEach(F f) const {
+        for (std::size_t w = 0; w < words.size(); w++) {
+            for (std::uint64_t bits = words[w]; bits != 0; bits &= bits - 1) {
+                f(w * 64 + static_cast<std::size_t>(std::countr_zero(bits)));
+            }
+        }
+    }
+};
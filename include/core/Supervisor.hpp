@@ -13,6 +13,6 @@ private:
 
     friend class EmployeeFactory;
 
-public:
-    void setSalary() override;
+protected:
+    int computeSalary() const override;
 };
\ No newline at end of file
@@ -3,12 +3,15 @@
 #include <vector>
 #include <string>
 #include <chrono>
+#include <map>
 
 #include "ServiceManager.hpp"
 #include "Appliance.hpp"
 #include "Employee.hpp"
+#include "SkillSet.hpp"
 
 class EmployeeFactory;
+class RepairRequest;
 
 struct Skill{
     ApplianceType type;
@@ -24,9 +27,14 @@ struct Skill{
 class Technician: public Employee{
 private:
 
-    std::vector<Skill> skills;
+    std::vector<Skill> skills;        // As entered, for display and saving
+    SkillSet skill_set;               // Same skills, for canRepair
     std::vector<int> active_request_ids;
 
+    // Performance bonus earned per month (keyed by the month the request was
+    // received in), updated when a request of this technician is completed
+    std::map<std::chrono::year_month, int> monthly_bonus;
+
     Technician(
         const int id, std::string first_name, std::string last_name,
         std::string CNP, std::chrono::year_month_day date_of_hiring,
@@ -34,19 +42,25 @@ private:
 
     friend class EmployeeFactory;
 
+protected:
+    int computeSalary() const override;
+
 public:
 
     std::vector<int> getCompletedRequests(std::chrono::year_month interval_start, std::chrono::year_month interval_end) const;
     int calculatePerformanceBonus() const;
+    void recordCompletedRequest(const RepairRequest& request);
+    int getMonthlyBonus(std::chrono::year_month month) const;
 
-    void setSalary() override;
-    int getSalary() const override;
     const std::vector<Skill>& getSkills() const;
+    const SkillSet& getSkillSet() const;
     bool canRepair(const Appliance& appliance) const;
     void addSkill(ApplianceType type, std::string brand);
     void addActiveRequest(int request_id);
     int getActiveRequestsCount() const;
-    const std::vector<int> getActiveRequests() const;
+    const std::vector<int>& getActiveRequests() const;
+    // Hands back every active request id and leaves the technician idle
+    std::vector<int> releaseActiveRequests();
 
     void tick();
 };
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class RepairRequest;
+class Technician;
+
+// ============================================================================
+// BATCH MATCHER
+// ============================================================================
+
+// Matches a batch of pending requests to free technician slots in one go.
+// Requests are taken in the order given (the scheduling policy's order) and
+// each one is matched along an augmenting path, so a generalist already
+// holding a job another technician could do hands it over instead of
+// leaving the new request stranded. Processing in priority order means no
+// matched request is ever displaced by a lower-priority one; the result is
+// a maximum matching whenever the time budget is not exceeded.
+class BatchMatcher {
+private:
+    // Per technician: free slots, currently matched requests, DFS stamp
+    std::vector<int> free_slots;
+    std::vector<std::vector<int>> matched;
+    std::vector<std::uint32_t> visited;
+    std::uint32_t stamp = 0;
+
+    // Per request: candidate technicians and the chosen one
+    std::vector<const std::vector<int>*> candidates;
+    std::vector<int> assignment;
+
+    // Candidate lists are shared by every request with the same appliance
+    // type and brand
+    std::vector<std::unique_ptr<std::vector<int>>> candidate_lists;
+    std::vector<int> candidate_list_of;  // Indexed by brand id * APPLIANCE_TYPE_COUNT + type
+
+    bool timed_out = false;
+
+    bool augment(int request);
+
+public:
+    // Returns, for each request, the index into `technicians` it was matched
+    // to, or -1. Technicians take at most `max_load` active requests. Stops
+    // early once `deadline` has passed; requests not reached stay at -1.
+    const std::vector<int>& solve(const std::vector<RepairRequest*>& requests,
+                                  const std::vector<std::unique_ptr<Technician>>& technicians,
+                                  int max_load,
+                                  std::chrono::steady_clock::time_point deadline);
+
+    // Whether the last solve() ran out of time
+    bool timedOut() const;
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// ============================================================================
+// JSON LINE SCANNER
+// ============================================================================
+
+// Walks one flat JSON object (a single JSON Lines record) in place. Keys and
+// values are handed out as string_views into the line, so scanning does not
+// allocate; only strings that contain escape sequences need unescape().
+// Nested objects and arrays are skipped over and reported as Composite.
+class JsonLineScanner {
+public:
+    enum class ValueKind { String, Number, Bool, Null, Composite };
+
+    struct Field {
+        std::string_view key;
+        std::string_view value;  // String contents without quotes, or the raw token
+        ValueKind kind;
+        bool escaped;            // String value contains backslash escapes
+    };
+
+private:
+    std::string_view text;
+    std::size_t pos;
+    bool error;
+    bool finished;
+
+    void skipWhitespace();
+    bool scanString(std::string_view& out, bool& escaped);
+    bool scanValue(Field& field);
+    bool skipComposite();
+    bool fail();
+
+public:
+    explicit JsonLineScanner(std::string_view line);
+
+    // Advances to the next key/value pair. Returns false at the end of the
+    // object or on malformed input (check failed() to tell them apart).
+    bool next(Field& field);
+    bool failed() const;
+
+    // Value conversions
+    static bool toInt(const Field& field, long long& out);
+    static bool toDouble(const Field& field, double& out);
+    static bool toBool(const Field& field, bool& out);
+    static std::string toString(const Field& field);
+    static std::string unescape(std::string_view raw);
+};
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+// ============================================================================
+// LATENCY HISTOGRAM
+// ============================================================================
+
+// Fixed-size histogram with power-of-two nanosecond buckets: bucket i holds
+// samples in [2^i, 2^(i+1)) ns. Recording is a couple of integer operations
+// and percentiles are accurate to within a factor of two.
+class LatencyHistogram {
+public:
+    static constexpr int BUCKETS = 40; // Up to ~18 minutes per sample
+
+private:
+    std::array<std::uint64_t, BUCKETS> buckets{};
+    std::uint64_t count = 0;
+    std::uint64_t total_ns = 0;
+    std::uint64_t max_ns = 0;
+
+public:
+    void record(std::chrono::nanoseconds latency);
+    void merge(const LatencyHistogram& other);
+    void reset();
+
+    // Getters
+    std::uint64_t getCount() const;
+    std::chrono::nanoseconds getMax() const;
+    std::chrono::nanoseconds getMean() const;
+    std::chrono::nanoseconds getTotal() const;
+    // Upper bound of the bucket holding the p-th percentile (p in [0, 100])
+    std::chrono::nanoseconds percentile(double p) const;
+    const std::array<std::uint64_t, BUCKETS>& getBuckets() const;
+};
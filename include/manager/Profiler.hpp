@@ -0,0 +1,108 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "LatencyHistogram.hpp"
+
+// ============================================================================
+// HOT-PATH PROFILER
+// ============================================================================
+
+// Phases of a simulation tick, timed separately
+enum class ProfilePhase {
+    Tick,            // Whole ServiceManager::tick()
+    CheckReceived,   // Received -> Pending / Rejected
+    AutoAssign,      // Matching pending requests to technicians
+    TechnicianTick,  // Advancing every technician's active requests
+    COUNT
+};
+
+// Events counted on the hot path
+enum class ProfileCounter {
+    RequestLookups,
+    EmployeeLookups,
+    Assignments,
+    COUNT
+};
+
+struct ProfileSnapshot {
+    std::array<LatencyHistogram, static_cast<std::size_t>(ProfilePhase::COUNT)> phases;
+    std::array<std::uint64_t, static_cast<std::size_t>(ProfileCounter::COUNT)> counters{};
+};
+
+// Process-wide collector behind the PROFILE_SCOPE / PROFILE_COUNT macros.
+// Like the manager itself it is not synchronized: it is only written from
+// code that already runs under the front end's manager lock.
+class Profiler {
+private:
+    ProfileSnapshot data;
+
+    Profiler() = default;
+
+public:
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    static Profiler& getInstance() {
+        static Profiler instance;
+        return instance;
+    }
+
+    // Compiled with -DFIXITNOW_PROFILING (make PROFILE=1, the default)
+    static constexpr bool isEnabled() {
+#ifdef FIXITNOW_PROFILING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void record(ProfilePhase phase, std::chrono::nanoseconds elapsed) {
+        data.phases[static_cast<std::size_t>(phase)].record(elapsed);
+    }
+    void count(ProfileCounter counter, std::uint64_t n = 1) {
+        data.counters[static_cast<std::size_t>(counter)] += n;
+    }
+
+    const ProfileSnapshot& getSnapshot() const;
+    void reset();
+    // Writes phases and counters as CSV
+    bool dump(const std::string& filename) const;
+
+    static const char* phaseName(ProfilePhase phase);
+    static const char* counterName(ProfileCounter counter);
+};
+
+// Times the enclosing scope into one phase
+class ScopedTimer {
+private:
+    ProfilePhase phase;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    explicit ScopedTimer(ProfilePhase phase)
+        : phase(phase), start(std::chrono::steady_clock::now()) {}
+
+    ~ScopedTimer() {
+        Profiler::getInstance().record(phase, std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start));
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+};
+
+// Without FIXITNOW_PROFILING both macros compile to nothing
+#ifdef FIXITNOW_PROFILING
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(phase) ScopedTimer PROFILE_CONCAT(profile_timer_, __LINE__)(ProfilePhase::phase)
+#define PROFILE_COUNT(counter) Profiler::getInstance().count(ProfileCounter::counter)
+#else
+#define PROFILE_SCOPE(phase) ((void)0)
+#define PROFILE_COUNT(counter) ((void)0)
+#endif
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class RepairRequest;
+
+// ============================================================================
+// SCHEDULING POLICY
+// ============================================================================
+
+enum class SchedulingPolicyKind {
+    FirstCome,       // Lowest request id first (the historical behaviour)
+    ShortestRepair,  // Shortest repair duration first
+    HighestPrice,    // Most expensive repair first
+    Aging,           // Earliest received timestamp first
+    FairShare        // Weighted round robin across brands
+};
+
+// Decides in which order pending requests are offered to technicians on
+// each auto-assign pass. The technician choice itself (least loaded, skill
+// match, at most 3 active requests) is not the policy's business.
+class SchedulingPolicy {
+public:
+    virtual ~SchedulingPolicy() = default;
+
+    virtual SchedulingPolicyKind kind() const = 0;
+
+    // Reorders this tick's pending requests, best candidate first. The
+    // vector arrives in id order.
+    virtual void order(std::vector<RepairRequest*>& pending) = 0;
+
+    // Called for every request the manager actually assigned
+    virtual void onAssigned(const RepairRequest& request);
+
+    // Where a pending request ranks among those needing the same skill:
+    // order() must put lower keys first, and equal keys in id order. The
+    // key may not change while the request is pending, so the manager can
+    // keep every skill's requests sorted by it and only hand the policy as
+    // many per skill as there are free technician slots for that skill.
+    virtual long long skillKey(const RepairRequest& request) const = 0;
+
+    // Forgets any history (e.g. after ServiceManager::clear())
+    virtual void reset();
+
+    static std::unique_ptr<SchedulingPolicy> create(SchedulingPolicyKind kind);
+    static std::optional<SchedulingPolicyKind> parseKind(std::string_view name);
+    static const char* kindName(SchedulingPolicyKind kind);
+    static const std::vector<SchedulingPolicyKind>& allKinds();
+};
+
+// ============================================================================
+// BUILT-IN POLICIES
+// ============================================================================
+
+class FirstComePolicy : public SchedulingPolicy {
+public:
+    SchedulingPolicyKind kind() const override;
+    void order(std::vector<RepairRequest*>& pending) override;
+    long long skillKey(const RepairRequest& request) const override;
+};
+
+class ShortestRepairPolicy : public SchedulingPolicy {
+public:
+    SchedulingPolicyKind kind() const override;
+    void order(std::vector<RepairRequest*>& pending) override;
+    long long skillKey(const RepairRequest& request) const override;
+};
+
+class HighestPricePolicy : public SchedulingPolicy {
+public:
+    SchedulingPolicyKind kind() const override;
+    void order(std::vector<RepairRequest*>& pending) override;
+    long long skillKey(const RepairRequest& request) const override;
+};
+
+class AgingPolicy : public SchedulingPolicy {
+public:
+    SchedulingPolicyKind kind() const override;
+    void order(std::vector<RepairRequest*>& pending) override;
+    long long skillKey(const RepairRequest& request) const override;
+};
+
+// Start-time fair queueing over brands. Every brand carries a finish tag
+// that grows by 1 / weight per assigned request, and a brand's next request
+// starts at max(its finish tag, the start tag of the last assignment).
+// Pending requests are interleaved by start tag, so busy brands share the
+// technicians in proportion to their weights and a brand that was idle
+// cannot claim a backlog of credit. Brands default to weight 1. Only the
+// requests that can be placed this pass are interleaved, so a brand's
+// blocked backlog does not push its placeable requests back.
+class FairSharePolicy : public SchedulingPolicy {
+private:
+    std::vector<double> weights;      // Indexed by brand id
+    std::vector<double> finish_tags;  // Indexed by brand id
+    double virtual_time = 0.0;
+
+    // Scratch buffers reused across ticks
+    std::vector<std::vector<RepairRequest*>> by_brand;
+    std::vector<int> active_brands;
+    std::vector<RepairRequest*> unregistered;
+
+    double weightOf(int brand_id) const;
+    double startTagOf(int brand_id) const;
+
+public:
+    SchedulingPolicyKind kind() const override;
+    void order(std::vector<RepairRequest*>& pending) override;
+    void onAssigned(const RepairRequest& request) override;
+    long long skillKey(const RepairRequest& request) const override;
+    void reset() override;
+
+    void setWeight(const std::string& brand, double weight);
+};
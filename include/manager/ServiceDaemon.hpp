@@ -0,0 +1,98 @@
+// ServiceDaemon.hpp
+#pragma once
+
+#include "ServiceManager.hpp"
+#include "TickScheduler.hpp"
+#include <atomic>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// SERVICE DAEMON - HEADLESS FRONT END
+// ============================================================================
+
+// Keeps the ServiceManager resident, ticks it in the background and serves
+// a line protocol over a Unix domain socket. Every command is one line and
+// gets exactly one response line ("OK ..." or "ERR ..."). Clients may
+// pipeline as many commands as they like: all complete lines received in
+// one read are executed under a single lock and answered with one write.
+//
+// Commands:
+//   PING
+//   ADD <type> <brand> <model> <year> <price> <complexity> <receptionist_id> <details...>
+//       Fridge: <has_freezer 0|1>   TV: <diagonal> <cm|inch>   WashingMachine: <capacity>
+//   STATUS <request_id>
+//   STATS
+//   TICK [count]         (1 to 1000 ticks, run at once)
+//   SPEED <ticks per second|max>
+//   PROFILE [reset|dump <filename>]
+//   POLICY [first-come|shortest-repair|highest-price|aging|fair-share [<brand>=<weight>...]]
+//   ASSIGN [greedy|batch [budget_us]]
+//   REPORT <top|longest|pending> <filename> [k]
+//   LOAD [employees_file] [requests_file]
+//   IMPORT <jsonl_file>  (bulk intake, see ServiceManager::importRepairRequestsFromJSONL)
+//   SAVE [employees_file] [requests_file]
+//   QUIT                 (closes this connection)
+//   SHUTDOWN             (stops the daemon)
+class ServiceDaemon {
+private:
+    struct Client {
+        int fd;
+        std::string input;
+        std::string output;
+        bool closing = false;
+    };
+
+    ServiceManager& manager;
+    RepairRequestFactory& requestFactory;
+    std::string socketPath;
+
+    std::atomic<bool> running{true};
+    std::mutex managerMutex;
+    std::thread tickThread;
+    TickScheduler scheduler;
+
+    int listenFd = -1;
+    std::vector<Client> clients;
+
+public:
+    ServiceDaemon(ServiceManager& mgr, RepairRequestFactory& reqFactory, std::string socketPath);
+    ~ServiceDaemon();
+
+    // Blocks until SHUTDOWN, SIGINT or SIGTERM
+    bool start();
+    void stop();
+
+private:
+    // Core loops
+    void tickLoop();
+    void serveLoop();
+
+    // Socket handling
+    bool openSocket();
+    void closeSocket();
+    void acceptClients();
+    bool readClient(Client& client);
+    bool writeClient(Client& client);
+
+    // Protocol
+    void processLines(Client& client);
+    std::string executeCommand(const std::string& line, Client& client);
+    std::string commandAdd(std::istringstream& args);
+    std::string commandStatus(std::istringstream& args);
+    std::string commandStats();
+    std::string commandTick(std::istringstream& args);
+    std::string commandSpeed(std::istringstream& args);
+    std::string commandProfile(std::istringstream& args);
+    std::string commandPolicy(std::istringstream& args);
+    std::string commandAssign(std::istringstream& args);
+    std::string commandReport(std::istringstream& args);
+    std::string commandLoad(std::istringstream& args);
+    std::string commandImport(std::istringstream& args);
+    std::string commandSave(std::istringstream& args);
+
+    std::string statusToString(Status status);
+};
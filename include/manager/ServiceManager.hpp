@@ -7,10 +7,39 @@
 #include <chrono>
 #include <fstream>
 #include <sstream>
+#include <iomanip>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <string_view>
+#include <tuple>
+#include <atomic>
+#include <cstdint>
+#include <array>
+#include <optional>
+#include <functional>
 
 #include "EmployeeFactory.hpp"
 #include "AddressFactory.hpp"
 #include "RepairRequestFactory.hpp"
+#include "Clock.hpp"
+#include "TopSalaries.hpp"
+#include "ServiceStats.hpp"
+#include "SkillSet.hpp"
+#include "SchedulingPolicy.hpp"
+#include "BatchMatcher.hpp"
+
+// Technician.hpp includes this header, so the employee types may still be
+// incomplete here
+class Technician;
+class Receptionist;
+class Supervisor;
+
+// How autoAssignRequests hands pending requests to technicians
+enum class AssignmentMode {
+    Greedy,  // One request at a time, to the least loaded capable technician
+    Batch    // Matching over the whole backlog at once (BatchMatcher), within a time budget
+};
 
 // ============================================================================
 // SERVICE MANAGER - SINGLETON PATTERN
@@ -22,9 +51,112 @@ private:
     ServiceManager(const ServiceManager&) = delete;
     ServiceManager& operator=(const ServiceManager&) = delete;
 
-    std::vector<std::unique_ptr<Employee>> employees;
+    // Employees are owned per type so that passes over technicians need no
+    // RTTI; `employees` is the unified view over all three
+    std::vector<std::unique_ptr<Technician>> technicians;
+    std::vector<std::unique_ptr<Receptionist>> receptionists;
+    std::vector<std::unique_ptr<Supervisor>> supervisors;
+    std::vector<Employee*> employees;
     std::vector<std::unique_ptr<RepairRequest>> repair_requests;
 
+    // Position of each employee in `employees` and in its typed container,
+    // by id. Removal swaps the last element into the freed slot, so
+    // employee order is not stable.
+    struct EmployeeSlot {
+        std::size_t index;
+        std::size_t typed_index;
+    };
+    std::unordered_map<int, EmployeeSlot> employee_slots;
+    template <typename T>
+    void eraseTyped(std::vector<std::unique_ptr<T>>& container, std::size_t typed_index);
+
+    // Unique index on CNP, keyed by CNPValidator::packKey()
+    std::unordered_map<std::uint64_t, Employee*> employees_by_cnp;
+
+    // Requests ordered by id, overall and per status, for lookups and paging
+    std::map<int, RepairRequest*> requests_by_id;
+    std::array<std::set<int>, STATUS_COUNT> request_ids_by_status;
+
+    // Time source for the whole simulation (real-time by default)
+    Clock clock;
+
+    // Pending requests grouped by (type, brand, model), kept up to date on
+    // every status transition. ApplianceType's declaration order matches the
+    // alphabetical order of its names, so the map iterates in report order.
+    // The comparator is transparent so lookups can use a non-owning key.
+    using ApplianceKey = std::tuple<ApplianceType, std::string, std::string>;
+    using ApplianceKeyView = std::tuple<ApplianceType, std::string_view, std::string_view>;
+    std::map<ApplianceKey, std::set<int>, std::less<>> pending_groups;
+
+    // Reused by the per-tick passes to snapshot the ids of one status, so a
+    // steady-state tick does not allocate
+    std::vector<int> tick_ids;
+    const std::vector<int>& snapshotIds(Status status);
+
+    // Order in which pending requests are offered to technicians
+    std::unique_ptr<SchedulingPolicy> scheduling_policy = SchedulingPolicy::create(SchedulingPolicyKind::FirstCome);
+    std::vector<RepairRequest*> tick_requests;
+
+    // A technician never works on more than this many requests at once
+    static constexpr int MAX_ACTIVE_REQUESTS = 3;
+    AssignmentMode assignment_mode = AssignmentMode::Greedy;
+    std::chrono::microseconds batch_budget{2000};
+    BatchMatcher batch_matcher;
+    void assignRequest(RepairRequest& request, Technician& technician);
+
+    // Pending requests bucketed by the skill they need (SkillSet::bitIndex).
+    // A bucket is only looked at by autoAssignRequests once it is marked
+    // ready: when a request enters it, or when a technician with that skill
+    // frees a slot, joins, or learns the skill. After a pass, whatever is
+    // left in a bucket is blocked until one of those happens again, so a
+    // tick with nothing new costs the same however long the backlog is.
+    // Each bucket is sorted by (policy skill key, id), the order in which
+    // the policy would offer those requests.
+    std::vector<std::set<std::pair<long long, int>>> pending_by_skill;
+    std::vector<char> skill_ready;
+    std::vector<std::size_t> ready_skills;
+    std::vector<std::uint64_t> skill_full_in_pass;  // Pass number in which the bucket ran out of technicians
+    std::uint64_t assign_pass = 0;
+    void markSkillReady(std::size_t skill);
+    std::size_t freeSlotsFor(std::size_t skill) const;
+
+    // Union of every technician's skills, for checkReceived
+    SkillSet skill_coverage;
+
+    // In-progress requests as (repair duration, request id), longest first
+    // and lowest id first on ties
+    struct LongerRepairFirst {
+        bool operator()(const std::pair<int, int>& a, const std::pair<int, int>& b) const {
+            if (a.first != b.first) return a.first > b.first;
+            return a.second < b.second;
+        }
+    };
+    std::set<std::pair<int, int>, LongerRepairFirst> in_progress_by_duration;
+
+    // Live counters behind getStats(). The salary total follows each change
+    // of a managed employee's salary by its difference; it is only re-summed
+    // once per simulated day, when every loyalty bonus may have moved.
+    ServiceStats stats;
+    mutable long long total_salaries = 0;
+    mutable std::chrono::year_month_day salaries_computed_on{};
+    mutable bool salaries_valid = false;
+
+    // Bumped on every change to employees, requests or the clock so that
+    // front ends can tell whether anything they display is out of date
+    std::atomic<std::uint64_t> generation{0};
+    void touch();
+
+    // Front ends can register a listener to be woken up on changes. It fires
+    // once for the first change after armChangeListener(), not on every
+    // change, so a burst of updates costs a single wakeup.
+    std::function<void()> change_listener;
+    std::atomic<bool> change_listener_armed{false};
+
+    // Status bookkeeping
+    void setRequestStatus(RepairRequest& request, Status new_status);
+    void indexRequest(const RepairRequest& request);
+    void unindexRequest(const RepairRequest& request, Status status);
+
 public:
 
     ServiceManager() = default;
@@ -35,14 +167,45 @@ public:
     }
 
     // Employee Management
-    void addEmployee(std::unique_ptr<Employee> employee);
-    void removeEmployeeById(int id);
+    // Rejects (returns false for) employees whose id is taken or whose CNP
+    // is not 13 digits or already belongs to someone else
+    [[nodiscard]] bool addEmployee(std::unique_ptr<Employee> employee);
+    // A removed technician's in-progress requests go back to Pending with
+    // their remaining time intact. Returns false if no such employee exists.
+    bool removeEmployeeById(int id);
     Employee* findEmployeeById(int id);
-    Employee* findEmployeeByCNP(std::string CNP);
+    Technician* findTechnicianById(int id);
+    Employee* findEmployeeByCNP(std::string_view CNP);
+
+    // Drops every employee and request along with the derived indexes.
+    // The clock is left alone.
+    void clear();
 
     // RepairRequest Management
     void addRepairRequest(std::unique_ptr<RepairRequest> repair_request);
+    // Inserts a whole batch with a single change notification; the vector is left empty
+    void addRepairRequests(std::vector<std::unique_ptr<RepairRequest>>& batch);
     RepairRequest* findRepairRequestById(int id) const;
+
+    // Cursor-based paging over requests ordered by id, optionally restricted
+    // to one status. Only the requested window is visited, so browsing stays
+    // cheap no matter how many requests exist.
+    std::vector<const RepairRequest*> getRequestsFrom(
+        int from_id, std::size_t limit, std::optional<Status> status = std::nullopt) const;
+    std::vector<const RepairRequest*> getRequestsBefore(
+        int before_id, std::size_t limit, std::optional<Status> status = std::nullopt) const;
+    std::size_t countRequests(std::optional<Status> status = std::nullopt) const;
+
+    // Must be called whenever a request's status changes outside the manager
+    // (e.g. a technician completing it) so the derived indexes stay in sync
+    void onStatusChanged(const RepairRequest& request, Status old_status);
+    // Same, for a request that was just ticked by its technician
+    void onRequestTicked(const RepairRequest& request, Status old_status);
+    void invalidateSalaryTotals();
+    // Called by Employee::invalidateSalary with the change of its cached salary
+    void onSalaryChanged(const Employee& employee, long long delta);
+    // Called by Technician::addSkill; ignored for technicians not (yet) managed
+    void onSkillAdded(const Technician& technician, ApplianceType type, int brand_id);
     
     // Filter
     std::vector<int> filter(
@@ -53,20 +216,59 @@ public:
         int receptionist_id = 0);
 
     bool canRepair(int repair_request_id) const;
+
+    // Scheduling policy used by autoAssignRequests; can be swapped at any time
+    void setSchedulingPolicy(std::unique_ptr<SchedulingPolicy> policy);
+    SchedulingPolicy& getSchedulingPolicy();
+
+    // Batch mode spends at most `budget` per tick on matching; requests it
+    // did not get to are assigned greedily in the same tick
+    void setAssignmentMode(AssignmentMode mode,
+                           std::chrono::microseconds budget = std::chrono::microseconds{2000});
+    AssignmentMode getAssignmentMode() const;
+    std::chrono::microseconds getBatchBudget() const;
+
+    // Planning queries: technicians whose skills include every skill in
+    // `required`, or at least one of them
+    std::vector<const Technician*> getTechniciansCoveringAll(const SkillSet& required) const;
+    std::vector<const Technician*> getTechniciansCoveringAny(const SkillSet& required) const;
     void autoAssignRequests();
     void checkReceived();
     void tick();
-    const std::vector<std::unique_ptr<Employee>>& getEmployees() const;
+    const std::vector<Employee*>& getEmployees() const;
+    const std::vector<std::unique_ptr<Technician>>& getTechnicians() const;
+    const std::vector<std::unique_ptr<Receptionist>>& getReceptionists() const;
+    const std::vector<std::unique_ptr<Supervisor>>& getSupervisors() const;
     const std::vector<std::unique_ptr<RepairRequest>>& getRepairRequests() const;
+
+    // Clock
+    Clock& getClock();
+    const Clock& getClock() const;
     
     // Save and Load functions
     bool saveToCSV(const std::string& employees_file = "Employees.csv", 
                    const std::string& requests_file = "RepairRequests.csv");
+    // False if a file could not be opened or any row was skipped; the rows
+    // that could be read stay loaded either way
     bool loadFromCSV(RepairRequestFactory& requestFactory,
                      const std::string& employees_file = "Employees.csv", 
                      const std::string& requests_file = "RepairRequests.csv");
+
+    // Bulk intake of repair requests, one JSON object per line
+    bool importRepairRequestsFromJSONL(RepairRequestFactory& requestFactory, const std::string& filename);
     
+    // Statistics
+    ServiceStats getStats() const;
+    std::uint64_t getGeneration() const;
+    void setChangeListener(std::function<void()> listener);
+    void armChangeListener();
+
+    // Leaderboard of in-progress requests, longest repair duration first
+    std::vector<int> getLongestRepairs(std::size_t n) const;
+
     // Reports
+    std::vector<const Employee*> getTopSalaries(std::size_t k) const;
+    bool generateTopSalariesReport(const std::string& filename, std::size_t k);
     bool generateTop3SalariesReport(const std::string& filename);
     bool generateLongestRepairReport(const std::string& filename);
     bool generatePendingRequestsReport(const std::string& filename);
@@ -75,8 +277,10 @@ private:
     // Helper functions for CSV operations
     bool saveEmployeesToCSV(const std::string& filename);
     bool saveRepairRequestsToCSV(const std::string& filename);
-    bool loadEmployeesFromCSV(const std::string& filename);
-    bool loadRepairRequestsFromCSV(RepairRequestFactory& requestFactory, const std::string& filename);
+    // Both count the rows they could not load into skipped_rows
+    bool loadEmployeesFromCSV(const std::string& filename, std::size_t& skipped_rows);
+    bool loadRepairRequestsFromCSV(RepairRequestFactory& requestFactory, const std::string& filename,
+                                   std::size_t& skipped_rows);
     
     // Helper to escape CSV fields
     std::string escapeCSV(const std::string& field);
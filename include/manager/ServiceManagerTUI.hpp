@@ -2,6 +2,8 @@
 #pragma once
 
 #include "ServiceManager.hpp"
+#include "TickScheduler.hpp"
+#include "Profiler.hpp"
 #include <ncurses.h>
 #include <thread>
 #include <atomic>
@@ -9,12 +11,16 @@
 #include <mutex>
 #include <string>
 #include <vector>
+#include <ctime>
+#include <cstdint>
+#include <optional>
 
 enum class MenuState {
     Main,
     EmployeeManagement,
     RequestManagement,
     ViewStatistics,
+    ViewProfiler,
     AddTechnician,
     AddReceptionist,
     AddSupervisor,
@@ -34,6 +40,7 @@ private:
     std::atomic<bool> running{true};
     std::mutex managerMutex;
     std::thread tickThread;
+    TickScheduler scheduler;
     
     MenuState currentMenu;
     int selectedItem;
@@ -42,6 +49,21 @@ private:
     // UI dimensions
     int maxY, maxX;
     
+    // Self-pipe written by the manager's change listener, so the UI loop can
+    // sleep on stdin and manager updates at the same time
+    int wakePipe[2] = {-1, -1};
+    
+    // Damage tracking: each screen region (header, content, footer) remembers
+    // what it was last drawn from and is only repainted when that changes
+    bool headerValid = false;
+    bool contentValid = false;
+    bool footerValid = false;
+    std::time_t drawnHeaderSecond = 0;
+    std::uint64_t drawnHeaderGeneration = 0;
+    MenuState drawnMenu = MenuState::Main;
+    int drawnItem = -1;
+    std::uint64_t drawnContentGeneration = 0;
+    
 public:
     ServiceManagerTUI(ServiceManager& mgr, RepairRequestFactory& reqFactory);
     ~ServiceManagerTUI();
@@ -55,15 +77,20 @@ private:
     
     // Drawing methods
     void drawUI();
+    void invalidateUI();
+    void changeSpeed(int direction);
+    void clearRegion(int fromRow, int toRow);
     void drawHeader();
     void drawFooter();
     void drawMainMenu();
     void drawEmployeeMenu();
     void drawRequestMenu();
     void drawStatistics();
+    void drawProfiler();
     
     // Input handling
-    void handleInput();
+    bool handleInput();
+    void waitForEvents();
     void handleSelection();
     
     // Menu actions - Employees
@@ -78,6 +105,7 @@ private:
     void showViewRequestDialog();
     void showListRequests();
     void showFilterRequestsDialog();
+    void showRequestBrowser(std::optional<Status> status);
     
     // Helper methods
     void showMessage(const std::string& message);
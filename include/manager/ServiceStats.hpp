@@ -0,0 +1,26 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "Employee.hpp"
+#include "RepairRequest.hpp"
+
+// ============================================================================
+// SERVICE STATISTICS SNAPSHOT
+// ============================================================================
+
+// Aggregates kept up to date by the ServiceManager on every add, remove,
+// status change and tick; copying one out is O(1).
+struct ServiceStats {
+    std::array<std::size_t, EMPLOYEE_TYPE_COUNT> employees_by_type{};  // Indexed by EmployeeType
+    std::array<std::size_t, STATUS_COUNT> requests_by_status{};        // Indexed by Status
+    std::size_t total_employees = 0;
+    std::size_t total_requests = 0;
+    long long completed_revenue = 0;
+    long long remaining_ticks = 0;   // Work left on in-progress requests
+    long long assignments = 0;       // Requests handed to a technician so far
+    long long batch_timeouts = 0;    // Batch assignment passes cut short by their budget
+    long long total_salaries = 0;    // Monthly salary expenses
+    long long tick_count = 0;
+};
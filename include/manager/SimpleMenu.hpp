@@ -47,6 +47,7 @@ private:
     
     // Repair request management
     void addRepairRequest();
+    void importRepairRequests();
     void listRepairRequests();
     
     // Simulation
@@ -63,6 +64,8 @@ private:
     Address inputAddress();
     std::unique_ptr<Appliance> inputAppliance();
     std::chrono::year_month_day inputDate();
+    std::string inputNewCNP();  // Loops until a valid, unused CNP is entered
+    void printCNPInfo(const CNPInfo& info);
     
     void clearScreen();
     void pause();
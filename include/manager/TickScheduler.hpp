@@ -0,0 +1,59 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+#include "LatencyHistogram.hpp"
+
+// ============================================================================
+// TICK SCHEDULER
+// ============================================================================
+
+// Timing statistics reported by the scheduler
+struct TickTimingStats {
+    LatencyHistogram latency;       // Wall time spent in each tick
+    std::uint64_t ticks = 0;
+    std::uint64_t overruns = 0;     // Ticks that took longer than their budget
+    std::uint64_t coalesced = 0;    // Deadlines dropped to catch up after overruns
+};
+
+// Paces the simulation loop. Runs at a configurable multiple of one tick per
+// second (0 means as fast as possible). When a tick overruns its budget the
+// missed deadlines are coalesced instead of being replayed in a burst.
+class TickScheduler {
+public:
+    static constexpr double MAX_SPEED = 0.0;
+    // Slowest throttled pace, about one tick every 11.5 days; slower
+    // periods would not fit in a steady_clock duration
+    static constexpr double MIN_SPEED = 1e-6;
+
+private:
+    mutable std::mutex mutex;
+    std::condition_variable wakeup;
+
+    double speed;  // Ticks per second relative to real time, MAX_SPEED = unthrottled
+    bool stopped;
+    std::chrono::steady_clock::time_point next_deadline;
+    TickTimingStats timing;
+
+    std::chrono::steady_clock::duration period() const;
+
+public:
+    explicit TickScheduler(double speed = 1.0);
+
+    // Speed control
+    void setSpeed(double new_speed);
+    double getSpeed() const;
+    void stop();
+    bool isStopped() const;
+
+    // Blocks until the next tick is due. Returns false once stopped.
+    bool waitForNextTick();
+    // Reports how long the tick that just ran took
+    void recordTick(std::chrono::steady_clock::duration latency);
+
+    TickTimingStats getTimingStats() const;
+    void resetTimingStats();
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+#include "Employee.hpp"
+
+// ============================================================================
+// TOP-K SALARY SELECTION
+// ============================================================================
+
+// Keeps the K best paid employees seen so far in a bounded heap, so ranking
+// N employees costs O(N log K). Employees can be offered one by one from any
+// source (the manager's vector, a CSV stream, a generator...).
+// Ranking: salary descending, then last name, then first name.
+class TopSalaries {
+private:
+    std::size_t k;
+    std::vector<const Employee*> heap; // Worst of the kept employees on top
+
+    static bool ranksBefore(const Employee* a, const Employee* b);
+
+public:
+    // candidates is how many employees will be offered, if known. Only
+    // min(k, candidates) slots are reserved, so a huge K costs nothing up front.
+    explicit TopSalaries(std::size_t k, std::size_t candidates = 0);
+
+    void offer(const Employee* employee);
+
+    template <typename Range>
+    void offerAll(const Range& employees) {
+        for (const auto& emp : employees) {
+            offer(&*emp);
+        }
+    }
+
+    std::size_t size() const;
+
+    // Kept employees, best paid first
+    std::vector<const Employee*> sorted() const;
+};
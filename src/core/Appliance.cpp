@@ -1,4 +1,6 @@
 #include "Appliance.hpp"
+#include "ServiceManager.hpp"
+#include "BrandRegistry.hpp"
 
 // Convert string to enum
 ApplianceType stringToApplianceType(const std::string& str) {
@@ -32,6 +34,7 @@ Appliance::Appliance(
     int price)
 :   type(type),
     brand(std::move(brand)), 
+    brand_id(UNREGISTERED_BRAND),
     model(std::move(model)), 
     year_of_manufacture(year), 
     catalog_price(price) 
@@ -39,18 +42,25 @@ Appliance::Appliance(
 
 // Getters
 ApplianceType Appliance::getType() const { return type; }
-std::string Appliance::getBrand() const { return brand; }
-std::string Appliance::getModel() const { return model; }
+const std::string& Appliance::getBrand() const { return brand; }
+int Appliance::getBrandId() const {
+    // Not cached while unknown: a technician may learn the brand later
+    if (brand_id == UNREGISTERED_BRAND) {
+        if (auto id = BrandRegistry::find(brand)) brand_id = *id;
+    }
+    return brand_id;
+}
+
+void Appliance::registerBrand() const {
+    if (brand_id == UNREGISTERED_BRAND) brand_id = BrandRegistry::intern(brand);
+}
+const std::string& Appliance::getModel() const { return model; }
 int Appliance::getYear() const { return year_of_manufacture; }
 int Appliance::getCatalogPrice() const { return catalog_price; }
 
 // Calculate age (for repair duration calculation)
 int Appliance::getAge() const {
-    using namespace std::chrono;
-
-    const auto today_tp = floor<days>(system_clock::now());
-
-    const year_month_day today{ today_tp };
+    const std::chrono::year_month_day today = ServiceManager::getInstance().getClock().today();
 
     int age = int(today.year()) - year_of_manufacture;
     return age;
@@ -0,0 +1,33 @@
+#include "BrandRegistry.hpp"
+
+std::mutex BrandRegistry::mutex;
+std::map<std::string, int, std::less<>> BrandRegistry::ids;
+std::deque<std::string> BrandRegistry::names;
+
+int BrandRegistry::intern(std::string_view brand) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = ids.find(brand);
+    if (it != ids.end()) return it->second;
+
+    int id = static_cast<int>(names.size());
+    names.emplace_back(brand);
+    ids.emplace(names.back(), id);
+    return id;
+}
+
+std::optional<int> BrandRegistry::find(std::string_view brand) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = ids.find(brand);
+    if (it == ids.end()) return std::nullopt;
+    return it->second;
+}
+
+const std::string& BrandRegistry::name(int id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return names.at(static_cast<std::size_t>(id));
+}
+
+std::size_t BrandRegistry::size() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return names.size();
+}
@@ -1,112 +1,204 @@
 #include "CNPValidator.hpp"
 
-bool CNPValidator::isValid(const std::string& cnp) {
-    return hasValidLength(cnp) &&
-           hasOnlyDigits(cnp) &&
-           hasValidSex(cnp) &&
-           hasValidYear(cnp) &&
-           hasValidMonth(cnp) &&
-           hasValidDay(cnp) &&
-           hasValidCounty(cnp) &&
-           hasValidChecksum(cnp);
-}
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
-std::string CNPValidator::getValidationError(const std::string& cnp) {
-    if (!hasValidLength(cnp)) return "CNP must have exactly 13 digits";
-    if (!hasOnlyDigits(cnp)) return "CNP must contain only digits";
-    if (!hasValidSex(cnp)) return "Invalid sex digit (first digit must be 1-9)";
-    if (!hasValidYear(cnp)) return "Invalid year in CNP";
-    if (!hasValidMonth(cnp)) return "Invalid month (must be 01-12)";
-    if (!hasValidDay(cnp)) return "Invalid day for the given month/year";
-    if (!hasValidCounty(cnp)) return "Invalid county code (must be 01-52)";
-    if (!hasValidChecksum(cnp)) return "Invalid CNP checksum";
-    return "Valid CNP";
-}
+CNPInfo CNPValidator::validate(std::string_view cnp) {
+    CNPInfo info;
+    if (cnp.size() != LENGTH) return info;
 
-bool CNPValidator::hasValidLength(const std::string& cnp) {
-    return cnp.length() == 13;
+    for (char c : cnp) {
+        if (c < '0' || c > '9') {
+            info.error = CNPError::NonDigit;
+            return info;
+        }
+    }
+
+    info.error = checkFields(cnp.data(), info);
+    if (info.error == CNPError::None && !checksumMatches(cnp.data(), weightedSum(cnp.data()))) {
+        info.error = CNPError::Checksum;
+    }
+    return info;
 }
 
-bool CNPValidator::hasOnlyDigits(const std::string& cnp) {
-    return std::all_of(cnp.begin(), cnp.end(), ::isdigit);
+bool CNPValidator::isValid(const std::string& cnp) {
+    return validate(cnp).isValid();
 }
 
-bool CNPValidator::hasValidSex(const std::string& cnp) {
-    char sex = cnp[0];
-    return sex >= '1' && sex <= '9';
+std::string CNPValidator::getValidationError(const std::string& cnp) {
+    return errorMessage(validate(cnp).error);
 }
 
-bool CNPValidator::hasValidYear(const std::string& cnp) {
-    int year = extractYear(cnp);
-    return year >= 1800 && year <= 2099;
+std::optional<std::uint64_t> CNPValidator::packKey(std::string_view cnp) {
+    if (cnp.size() != LENGTH) return std::nullopt;
+
+    std::uint64_t key = 0;
+    for (char c : cnp) {
+        if (c < '0' || c > '9') return std::nullopt;
+        key = key * 10 + static_cast<std::uint64_t>(c - '0');
+    }
+    return key;
 }
 
-bool CNPValidator::hasValidMonth(const std::string& cnp) {
-    int month = extractMonth(cnp);
-    return month >= 1 && month <= 12;
+bool CNPValidator::isLeapYear(int year) {
+    return (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
 }
 
-bool CNPValidator::hasValidDay(const std::string& cnp) {
-    int year = extractYear(cnp);
-    int month = extractMonth(cnp);
-    int day = extractDay(cnp);
+int CNPValidator::getDaysInMonth(int month, int year) {
+    const int daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    
+    if (month < 1 || month > 12) return 0;
+    
+    int days = daysInMonth[month - 1];
+    if (month == 2 && isLeapYear(year)) days = 29;
     
-    if (day < 1) return false;
-    return day <= getDaysInMonth(month, year);
+    return days;
 }
 
-bool CNPValidator::hasValidCounty(const std::string& cnp) {
-    int county = std::stoi(cnp.substr(7, 2));
-    return county >= 1 && county <= 52;
+// ============================================================================
+// BATCH VALIDATION
+// ============================================================================
+
+const char* CNPValidator::errorMessage(CNPError error) {
+    switch (error) {
+        case CNPError::None: return "Valid CNP";
+        case CNPError::Length: return "CNP must have exactly 13 digits";
+        case CNPError::NonDigit: return "CNP must contain only digits";
+        case CNPError::Sex: return "Invalid sex digit (first digit must be 1-9)";
+        case CNPError::Year: return "Invalid year in CNP";
+        case CNPError::Month: return "Invalid month (must be 01-12)";
+        case CNPError::Day: return "Invalid day for the given month/year";
+        case CNPError::County: return "Invalid county code (must be 01-52)";
+        case CNPError::Checksum: return "Invalid CNP checksum";
+    }
+    return "Unknown CNP error";
 }
 
-bool CNPValidator::hasValidChecksum(const std::string& cnp) {
-    const std::string weights = "279146358279";
+int CNPValidator::weightedSum(const char* d) {
+    static const int weights[12] = {2, 7, 9, 1, 4, 6, 3, 5, 8, 2, 7, 9};
     int sum = 0;
-    
     for (int i = 0; i < 12; i++) {
-        sum += (cnp[i] - '0') * (weights[i] - '0');
+        sum += (d[i] - '0') * weights[i];
     }
-    
-    int checksum = sum % 11;
-    if (checksum == 10) checksum = 1;
-    
-    return (cnp[12] - '0') == checksum;
+    return sum;
 }
 
-int CNPValidator::extractYear(const std::string& cnp) {
-    char sex = cnp[0];
-    int yy = std::stoi(cnp.substr(1, 2));
-    
-    // Determine century based on sex digit
-    if (sex == '1' || sex == '2') return 1900 + yy;
-    if (sex == '3' || sex == '4') return 1800 + yy;
-    if (sex == '5' || sex == '6') return 2000 + yy;
-    if (sex == '7' || sex == '8') return 2000 + yy; // Residents
-    if (sex == '9') return 2000 + yy; // Foreign residents
-    
-    return 1900 + yy; // Default fallback
+bool CNPValidator::checksumMatches(const char* d, int weighted_sum) {
+    int checksum = weighted_sum % 11;
+    if (checksum == 10) checksum = 1;
+    return d[12] - '0' == checksum;
 }
 
-int CNPValidator::extractMonth(const std::string& cnp) {
-    return std::stoi(cnp.substr(3, 2));
-}
+CNPError CNPValidator::checkFields(const char* d, CNPInfo& info) {
+    auto two = [d](int at) { return (d[at] - '0') * 10 + (d[at + 1] - '0'); };
+
+    info.sex = d[0] - '0';
+    if (info.sex < 1) return CNPError::Sex;
 
-int CNPValidator::extractDay(const std::string& cnp) {
-    return std::stoi(cnp.substr(5, 2));
+    // 1/2: 1900s, 3/4: 1800s, 5-9: 2000s (7-9 are residents)
+    int century = (info.sex <= 2) ? 1900 : (info.sex <= 4) ? 1800 : 2000;
+    int year = century + two(1);
+    if (year < 1800 || year > 2099) return CNPError::Year;
+
+    int month = two(3);
+    if (month < 1 || month > 12) return CNPError::Month;
+
+    int day = two(5);
+    if (day < 1 || day > getDaysInMonth(month, year)) return CNPError::Day;
+
+    info.birth_date = std::chrono::year_month_day{
+        std::chrono::year{year},
+        std::chrono::month{static_cast<unsigned>(month)},
+        std::chrono::day{static_cast<unsigned>(day)}
+    };
+
+    info.county = two(7);
+    if (info.county < 1 || info.county > 52) return CNPError::County;
+
+    return CNPError::None;
 }
 
-bool CNPValidator::isLeapYear(int year) {
-    return (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
+void CNPValidator::validateBatch(const char* records, std::size_t count, CNPError* errors) {
+    std::size_t i = 0;
+
+#if defined(__SSE2__)
+    // 16-byte loads cover one 13-digit record plus 3 bytes of the next one,
+    // so the last record is left to the scalar loop below
+    const __m128i zero = _mm_set1_epi8('0');
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i nothing = _mm_setzero_si128();
+    const __m128i weights_lo = _mm_setr_epi16(2, 7, 9, 1, 4, 6, 3, 5);
+    const __m128i weights_hi = _mm_setr_epi16(8, 2, 7, 9, 0, 0, 0, 0);
+
+    for (; i + 1 < count; i++) {
+        const char* d = records + i * LENGTH;
+        __m128i digits = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(d)), zero);
+
+        // A byte is a digit when 0 <= c - '0' <= 9 (signed compare)
+        __m128i bad = _mm_or_si128(_mm_cmpgt_epi8(digits, nine), _mm_cmplt_epi8(digits, nothing));
+        if (_mm_movemask_epi8(bad) & 0x1FFF) {
+            errors[i] = CNPError::NonDigit;
+            continue;
+        }
+
+        // Weighted checksum as two 8-lane multiply-adds on 16-bit digits
+        __m128i lo = _mm_unpacklo_epi8(digits, nothing);
+        __m128i hi = _mm_unpackhi_epi8(digits, nothing);
+        __m128i sums = _mm_add_epi32(_mm_madd_epi16(lo, weights_lo), _mm_madd_epi16(hi, weights_hi));
+        sums = _mm_add_epi32(sums, _mm_shuffle_epi32(sums, _MM_SHUFFLE(1, 0, 3, 2)));
+        sums = _mm_add_epi32(sums, _mm_shuffle_epi32(sums, _MM_SHUFFLE(2, 3, 0, 1)));
+        int sum = _mm_cvtsi128_si32(sums);
+
+        CNPInfo info;
+        CNPError error = checkFields(d, info);
+        if (error == CNPError::None && !checksumMatches(d, sum)) {
+            error = CNPError::Checksum;
+        }
+        errors[i] = error;
+    }
+#endif
+
+    for (; i < count; i++) {
+        const char* d = records + i * LENGTH;
+
+        bool digits = true;
+        for (std::size_t k = 0; k < LENGTH; k++) {
+            digits = digits && d[k] >= '0' && d[k] <= '9';
+        }
+        if (!digits) {
+            errors[i] = CNPError::NonDigit;
+            continue;
+        }
+
+        CNPInfo info;
+        CNPError error = checkFields(d, info);
+        if (error == CNPError::None && !checksumMatches(d, weightedSum(d))) {
+            error = CNPError::Checksum;
+        }
+        errors[i] = error;
+    }
 }
 
-int CNPValidator::getDaysInMonth(int month, int year) {
-    const int daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-    
-    if (month < 1 || month > 12) return 0;
-    
-    int days = daysInMonth[month - 1];
-    if (month == 2 && isLeapYear(year)) days = 29;
-    
-    return days;
-}
\ No newline at end of file
+std::vector<CNPError> CNPValidator::validateBatch(const std::vector<std::string>& cnps) {
+    std::vector<CNPError> errors(cnps.size(), CNPError::Length);
+
+    // Pack the well-sized CNPs into one fixed-width buffer
+    std::string packed;
+    std::vector<std::size_t> positions;
+    packed.reserve(cnps.size() * LENGTH);
+    positions.reserve(cnps.size());
+    for (std::size_t i = 0; i < cnps.size(); i++) {
+        if (cnps[i].size() == LENGTH) {
+            packed += cnps[i];
+            positions.push_back(i);
+        }
+    }
+
+    std::vector<CNPError> results(positions.size());
+    validateBatch(packed.data(), positions.size(), results.data());
+    for (std::size_t k = 0; k < positions.size(); k++) {
+        errors[positions[k]] = results[k];
+    }
+    return errors;
+}
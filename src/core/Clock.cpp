@@ -0,0 +1,50 @@
+#include "Clock.hpp"
+
+Clock::Clock()
+:   mode(ClockMode::RealTime),
+    origin(),
+    tick_length(std::chrono::hours{1}),
+    ticks(0)
+{}
+
+void Clock::setRealTime() {
+    mode = ClockMode::RealTime;
+}
+
+void Clock::setSimulated(std::chrono::system_clock::time_point start,
+                         std::chrono::system_clock::duration step) {
+    mode = ClockMode::SimulatedTick;
+    origin = start;
+    tick_length = step;
+    ticks = 0;
+}
+
+void Clock::freeze(std::chrono::system_clock::time_point at) {
+    mode = ClockMode::Frozen;
+    origin = at;
+}
+
+void Clock::freeze() { freeze(now()); }
+
+void Clock::advance(long long count) {
+    // The tick counter always moves so callers can tell ticks apart,
+    // but only the simulated mode turns ticks into elapsed time
+    ticks += count;
+}
+
+std::chrono::system_clock::time_point Clock::now() const {
+    switch (mode) {
+        case ClockMode::RealTime: return std::chrono::system_clock::now();
+        case ClockMode::SimulatedTick: return origin + tick_length * ticks;
+        case ClockMode::Frozen: return origin;
+    }
+    return std::chrono::system_clock::now();
+}
+
+std::chrono::year_month_day Clock::today() const {
+    return std::chrono::year_month_day{ std::chrono::floor<std::chrono::days>(now()) };
+}
+
+ClockMode Clock::getMode() const { return mode; }
+long long Clock::getTickCount() const { return ticks; }
+std::chrono::system_clock::duration Clock::getTickLength() const { return tick_length; }
@@ -1,4 +1,5 @@
 #include "Employee.hpp"
+#include "ServiceManager.hpp"
 
 int Employee::calculateTransportBonus() const{
     if (residence.getCity() != "Bucharest")
@@ -7,11 +8,7 @@ int Employee::calculateTransportBonus() const{
 }
 
 int Employee::getNumYearsWorked() const {
-    using namespace std::chrono;
-
-    const auto today_tp = floor<days>(system_clock::now());
-
-    const year_month_day today{ today_tp };
+    const std::chrono::year_month_day today = ServiceManager::getInstance().getClock().today();
 
     int years = int(today.year()) - int(date_of_hiring.year());
 
@@ -32,13 +29,42 @@ int Employee::calculateLoyaltyBonus() const{
     return BASE_SALARY * 0.05 * loyaltyPeriods; 
 }
 
-void Employee::setSalary(){
+int Employee::computeSalary() const {
     int loyalty_bonus = calculateLoyaltyBonus();
     int transport_bonus = calculateTransportBonus();
-    salary = BASE_SALARY + loyalty_bonus + transport_bonus;
+    return BASE_SALARY + loyalty_bonus + transport_bonus;
+}
+
+void Employee::refreshSalary() const {
+    salary = computeSalary();
+    salary_computed_on = ServiceManager::getInstance().getClock().today();
+    salary_valid = true;
 }
 
-int Employee::getSalary() const { return salary; }
+void Employee::setSalary(){ invalidateSalary(); }
+
+void Employee::invalidateSalary() {
+    // Recomputed right away so the manager's total moves by the difference
+    // instead of being re-summed over every employee
+    ServiceManager& manager = ServiceManager::getInstance();
+    bool was_current = salary_valid && salary_computed_on == manager.getClock().today();
+    int old_salary = salary;
+    refreshSalary();
+    if (was_current) {
+        manager.onSalaryChanged(*this, salary - old_salary);
+    } else {
+        manager.invalidateSalaryTotals();
+    }
+}
+
+int Employee::getSalary() const {
+    // Loyalty depends on the day and the technician bonus on the month,
+    // so the cached value stays good until the clock reaches another day
+    if (!salary_valid || salary_computed_on != ServiceManager::getInstance().getClock().today()) {
+        refreshSalary();
+    }
+    return salary;
+}
 
 Employee::Employee(
     const int id,
@@ -54,7 +80,10 @@ Employee::Employee(
     CNP(std::move(CNP)),
     date_of_hiring(std::move(date_of_hiring)),
     residence(std::move(residence)),
-    type(type)
+    type(type),
+    salary(0),
+    salary_computed_on(),
+    salary_valid(false)
 {}
 
 int Employee::getId() const { return id; };
@@ -68,4 +97,9 @@ const std::chrono::year_month_day& Employee::getDateOfHiring() const { return da
 const Address& Employee::getResidence() const { return residence; }
 
 void Employee::changeFirstName(std::string new_first_name) { first_name = new_first_name; }
-void Employee::changeLastName(std::string new_last_name) { last_name = new_last_name; }
\ No newline at end of file
+void Employee::changeLastName(std::string new_last_name) { last_name = new_last_name; }
+
+void Employee::changeDateOfHiring(std::chrono::year_month_day new_date_of_hiring) {
+    date_of_hiring = new_date_of_hiring;
+    invalidateSalary();
+}
\ No newline at end of file
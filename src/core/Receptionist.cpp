@@ -19,11 +19,11 @@ Receptionist::Receptionist(
 {}
 
 void Receptionist::setReceivedRepairRequests(std::vector<int> new_received_repair_requests){
-    received_repair_requests = new_received_repair_requests;
+    received_repair_requests = std::move(new_received_repair_requests);
 }
 
 void Receptionist::addReceivedRepairRequest(int new_received_repair_request){
     received_repair_requests.push_back(new_received_repair_request);
 }
 
-std::vector<int> Receptionist::getReceivedRepairRequests() { return received_repair_requests; }
\ No newline at end of file
+const std::vector<int>& Receptionist::getReceivedRepairRequests() const { return received_repair_requests; }
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include "SkillSet.hpp"
+#include "BrandRegistry.hpp"
+
+#include <algorithm>
+
+void SkillSet::add(ApplianceType type, int brand_id) {
+    std::size_t bit = bitIndex(type, brand_id);
+    if (bit / 64 >= words.size()) {
+        words.resize(bit / 64 + 1, 0);
+    }
+    words[bit / 64] |= std::uint64_t{1} << (bit % 64);
+}
+
+void SkillSet::add(ApplianceType type, std::string_view brand) {
+    add(type, BrandRegistry::intern(brand));
+}
+
+void SkillSet::addAll(const SkillSet& other) {
+    if (other.words.size() > words.size()) {
+        words.resize(other.words.size(), 0);
+    }
+    for (std::size_t i = 0; i < other.words.size(); i++) {
+        words[i] |= other.words[i];
+    }
+}
+
+void SkillSet::clear() { words.clear(); }
+
+bool SkillSet::containsAll(const SkillSet& other) const {
+    for (std::size_t i = 0; i < other.words.size(); i++) {
+        std::uint64_t mine = i < words.size() ? words[i] : 0;
+        if ((other.words[i] & ~mine) != 0) return false;
+    }
+    return true;
+}
+
+bool SkillSet::intersects(const SkillSet& other) const {
+    std::size_t common = std::min(words.size(), other.words.size());
+    for (std::size_t i = 0; i < common; i++) {
+        if ((words[i] & other.words[i]) != 0) return true;
+    }
+    return false;
+}
+
+bool SkillSet::empty() const {
+    for (std::uint64_t word : words) {
+        if (word != 0) return false;
+    }
+    return true;
+}
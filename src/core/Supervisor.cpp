@@ -18,7 +18,7 @@ Supervisor::Supervisor(
     )
 {}
 
-void Supervisor::setSalary(){
+int Supervisor::computeSalary() const {
 
-    salary = (BASE_SALARY + calculateTransportBonus() + calculateLoyaltyBonus())*1.2;
+    return (BASE_SALARY + calculateTransportBonus() + calculateLoyaltyBonus())*1.2;
 }
\ No newline at end of file
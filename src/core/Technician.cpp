@@ -1,4 +1,7 @@
 #include "Technician.hpp"
+#include "BrandRegistry.hpp"
+
+#include <utility>
 
 Skill::Skill(ApplianceType type, std::string brand): type(type), brand(brand){};
 
@@ -20,20 +23,14 @@ Technician::Technician(
 {}
 
 bool Technician::canRepair(const Appliance& appliance) const {
-    ApplianceType app_type = appliance.getType();
-    std::string app_brand = appliance.getBrand();
-    
-    for (const auto& skill : skills) {
-        if (skill.type == app_type && skill.brand == app_brand) {
-            return true;
-        }
-    }
-    
-    return false;
+    return skill_set.contains(appliance);
 }
 
 void Technician::addSkill(ApplianceType type, std::string brand) {
-    skills.push_back(Skill(type, brand));
+    int brand_id = BrandRegistry::intern(brand);
+    skill_set.add(type, brand_id);
+    skills.push_back(Skill(type, std::move(brand)));
+    ServiceManager::getInstance().onSkillAdded(*this, type, brand_id);
 }
 
 void Technician::addActiveRequest(int request_id) {
@@ -47,10 +44,12 @@ void Technician::tick() {
         RepairRequest* request = manager.findRepairRequestById(*it);
         
         if (request) {
+            Status old_status = request->getStatus();
             request->tick(); // Decrement remaining time
+            manager.onRequestTicked(*request, old_status);
             
             if (request->isCompleted()) {
-                //I need an observer here
+                recordCompletedRequest(*request);
                 it = active_request_ids.erase(it);
             } else {
                 ++it;
@@ -63,13 +62,9 @@ void Technician::tick() {
     }
 }
 
-void Technician::setSalary() {
-    Employee::setSalary(); // Start with base salary logic
-    salary += calculatePerformanceBonus();
-}
-
-int Technician::getSalary() const {
-    return salary;
+int Technician::computeSalary() const {
+    // Start with base salary logic
+    return Employee::computeSalary() + calculatePerformanceBonus();
 }
 
 std::vector<int> Technician::getCompletedRequests(std::chrono::year_month interval_start, std::chrono::year_month interval_end) const {
@@ -89,24 +84,31 @@ std::vector<int> Technician::getCompletedRequests(std::chrono::year_month interv
 
 int Technician::calculatePerformanceBonus() const {
 
-    auto now = std::chrono::system_clock::now();
-    auto today = std::chrono::year_month_day{std::chrono::floor<std::chrono::days>(now)};
+    auto today = ServiceManager::getInstance().getClock().today();
     
     auto current_month = today.year() / today.month();
     auto last_month = current_month - std::chrono::months{1};
 
-    std::vector<int> completed_ids = getCompletedRequests(last_month, last_month);
+    return getMonthlyBonus(last_month);
+}
 
-    int performance_bonus = 0;
+void Technician::recordCompletedRequest(const RepairRequest& request) {
+    auto received_on = std::chrono::year_month_day{std::chrono::floor<std::chrono::days>(request.getTimestamp())};
+    auto month = received_on.year() / received_on.month();
 
-    for (auto completed_id : completed_ids){
-        performance_bonus += (ServiceManager::getInstance().findRepairRequestById(completed_id)->getPrice())*0.02;
-    }
+    monthly_bonus[month] += request.getPrice()*0.02;
+    invalidateSalary();
+}
 
-    return performance_bonus;
+int Technician::getMonthlyBonus(std::chrono::year_month month) const {
+    auto it = monthly_bonus.find(month);
+    if (it == monthly_bonus.end()) return 0;
+    return it->second;
 }
 
 int Technician::getActiveRequestsCount() const { return active_request_ids.size(); }
-const std::vector<int> Technician::getActiveRequests() const { return active_request_ids; }
+const std::vector<int>& Technician::getActiveRequests() const { return active_request_ids; }
+std::vector<int> Technician::releaseActiveRequests() { return std::exchange(active_request_ids, {}); }
 
-const std::vector<Skill>& Technician::getSkills() const { return skills; }
\ No newline at end of file
+const std::vector<Skill>& Technician::getSkills() const { return skills; }
+const SkillSet& Technician::getSkillSet() const { return skill_set; }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "RepairRequestFactory.hpp"
+#include "ServiceManager.hpp"
 
 //Factory Initialization for loading the next id
 int RepairRequestFactory::next_id = 0;
@@ -17,7 +18,7 @@ std::unique_ptr<RepairRequest> RepairRequestFactory::createRepairRequest(
     return std::make_unique<RepairRequest> (RepairRequest(
         next_id++,
         std::move(appliance),
-        std::chrono::system_clock::now(),
+        ServiceManager::getInstance().getClock().now(),
         complexity,
         repair_duration,
         remaining_time,
@@ -1,17 +1,26 @@
 #include "SimpleMenu.hpp"
+#include "ServiceDaemon.hpp"
 #include "ServiceManager.hpp"
 #include "RepairRequestFactory.hpp"
+#include <string>
 
-int main() {
+int main(int argc, char* argv[]) {
     // Get ServiceManager singleton instance
     ServiceManager& manager = ServiceManager::getInstance();
     
     // Create RepairRequestFactory
     RepairRequestFactory requestFactory(1);
     
+    // Headless mode: ./app --daemon [socket_path]
+    if (argc > 1 && std::string(argv[1]) == "--daemon") {
+        std::string socketPath = (argc > 2) ? argv[2] : "/tmp/fixitnow.sock";
+        ServiceDaemon daemon(manager, requestFactory, socketPath);
+        return daemon.start() ? 0 : 1;
+    }
+    
     // Create and start the simple menu
     SimpleMenu menu(manager, requestFactory);
     menu.start();
     
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,91 @@
+#include "BatchMatcher.hpp"
+#include "Technician.hpp"
+#include "RepairRequest.hpp"
+#include "SkillSet.hpp"
+
+#include <algorithm>
+
+const std::vector<int>& BatchMatcher::solve(const std::vector<RepairRequest*>& requests,
+                                            const std::vector<std::unique_ptr<Technician>>& technicians,
+                                            int max_load,
+                                            std::chrono::steady_clock::time_point deadline) {
+    std::size_t tech_count = technicians.size();
+    free_slots.assign(tech_count, 0);
+    matched.resize(tech_count);
+    visited.assign(tech_count, 0);
+    stamp = 0;
+    for (std::size_t t = 0; t < tech_count; t++) {
+        free_slots[t] = std::max(0, max_load - technicians[t]->getActiveRequestsCount());
+        matched[t].clear();
+    }
+
+    candidate_lists.clear();
+    candidate_list_of.clear();
+    candidates.assign(requests.size(), nullptr);
+    assignment.assign(requests.size(), -1);
+    timed_out = false;
+
+    for (std::size_t r = 0; r < requests.size(); r++) {
+        // The clock is cheap next to an augmenting search, so check every request
+        if (std::chrono::steady_clock::now() >= deadline) {
+            timed_out = true;
+            break;
+        }
+
+        // A brand nobody registered has no technician; the request stays unmatched
+        const Appliance& appliance = requests[r]->getAppliance();
+        int brand_id = appliance.getBrandId();
+        if (brand_id == Appliance::UNREGISTERED_BRAND) continue;
+        std::size_t key = SkillSet::bitIndex(appliance.getType(), brand_id);
+        if (key >= candidate_list_of.size()) candidate_list_of.resize(key + 1, -1);
+        if (candidate_list_of[key] < 0) {
+            auto list = std::make_unique<std::vector<int>>();
+            for (std::size_t t = 0; t < tech_count; t++) {
+                if (technicians[t]->canRepair(appliance)) list->push_back(static_cast<int>(t));
+            }
+            candidate_list_of[key] = static_cast<int>(candidate_lists.size());
+            candidate_lists.push_back(std::move(list));
+        }
+        candidates[r] = candidate_lists[candidate_list_of[key]].get();
+
+        stamp++;
+        augment(static_cast<int>(r));
+    }
+
+    return assignment;
+}
+
+bool BatchMatcher::augment(int request) {
+    const std::vector<int>& techs = *candidates[request];
+
+    // A free slot ends the path right away; take the least loaded technician
+    int best = -1;
+    for (int t : techs) {
+        if (free_slots[t] > 0 && (best < 0 || free_slots[t] > free_slots[best])) {
+            best = t;
+        }
+    }
+    if (best >= 0) {
+        free_slots[best]--;
+        matched[best].push_back(request);
+        assignment[request] = best;
+        return true;
+    }
+
+    // Otherwise ask a request already matched to a candidate to move over
+    for (int t : techs) {
+        if (visited[t] == stamp) continue;
+        visited[t] = stamp;
+        for (int& other : matched[t]) {
+            int moved = other;
+            if (augment(moved)) {
+                other = request;
+                assignment[request] = t;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool BatchMatcher::timedOut() const { return timed_out; }
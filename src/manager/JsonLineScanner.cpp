@@ -0,0 +1,229 @@
+#include "JsonLineScanner.hpp"
+#include <charconv>
+#include <limits>
+
+JsonLineScanner::JsonLineScanner(std::string_view line)
+:   text(line),
+    pos(0),
+    error(false),
+    finished(false)
+{
+    skipWhitespace();
+    if (pos >= text.size() || text[pos] != '{') {
+        fail();
+        return;
+    }
+    pos++;
+}
+
+bool JsonLineScanner::failed() const { return error; }
+
+bool JsonLineScanner::fail() {
+    error = true;
+    finished = true;
+    return false;
+}
+
+void JsonLineScanner::skipWhitespace() {
+    while (pos < text.size() &&
+           (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\r' || text[pos] == '\n')) {
+        pos++;
+    }
+}
+
+bool JsonLineScanner::scanString(std::string_view& out, bool& escaped) {
+    // pos is on the opening quote
+    std::size_t start = ++pos;
+    escaped = false;
+
+    while (pos < text.size()) {
+        char c = text[pos];
+        if (c == '"') {
+            out = text.substr(start, pos - start);
+            pos++;
+            return true;
+        }
+        if (c == '\\') {
+            escaped = true;
+            pos++;  // Skip the escaped character, \uXXXX digits are plain chars
+        }
+        pos++;
+    }
+    return false;
+}
+
+bool JsonLineScanner::skipComposite() {
+    // pos is on '{' or '['; strings are skipped whole so brackets inside them don't count
+    int depth = 0;
+    while (pos < text.size()) {
+        char c = text[pos];
+        if (c == '"') {
+            std::string_view ignored;
+            bool escaped;
+            if (!scanString(ignored, escaped)) return false;
+            continue;
+        }
+        if (c == '{' || c == '[') depth++;
+        if (c == '}' || c == ']') {
+            if (--depth == 0) {
+                pos++;
+                return true;
+            }
+        }
+        pos++;
+    }
+    return false;
+}
+
+bool JsonLineScanner::scanValue(Field& field) {
+    if (pos >= text.size()) return false;
+
+    std::size_t start = pos;
+    char c = text[pos];
+    field.escaped = false;
+
+    if (c == '"') {
+        field.kind = ValueKind::String;
+        return scanString(field.value, field.escaped);
+    }
+    if (c == '{' || c == '[') {
+        field.kind = ValueKind::Composite;
+        if (!skipComposite()) return false;
+        field.value = text.substr(start, pos - start);
+        return true;
+    }
+
+    // Bare token: number, true, false or null
+    while (pos < text.size() && text[pos] != ',' && text[pos] != '}' &&
+           text[pos] != ' ' && text[pos] != '\t' && text[pos] != '\r' && text[pos] != '\n') {
+        pos++;
+    }
+    field.value = text.substr(start, pos - start);
+
+    if (field.value == "true" || field.value == "false") field.kind = ValueKind::Bool;
+    else if (field.value == "null") field.kind = ValueKind::Null;
+    else if (!field.value.empty() && (c == '-' || (c >= '0' && c <= '9'))) field.kind = ValueKind::Number;
+    else return false;
+
+    return true;
+}
+
+bool JsonLineScanner::next(Field& field) {
+    if (finished) return false;
+
+    skipWhitespace();
+    if (pos < text.size() && text[pos] == '}') {
+        finished = true;
+        return false;
+    }
+    if (pos >= text.size() || text[pos] != '"') return fail();
+
+    bool keyEscaped;
+    if (!scanString(field.key, keyEscaped)) return fail();
+
+    skipWhitespace();
+    if (pos >= text.size() || text[pos] != ':') return fail();
+    pos++;
+    skipWhitespace();
+
+    if (!scanValue(field)) return fail();
+
+    skipWhitespace();
+    if (pos < text.size() && text[pos] == ',') {
+        pos++;
+    } else if (pos >= text.size() || text[pos] != '}') {
+        return fail();
+    }
+    return true;
+}
+
+// ============================================================================
+// VALUE CONVERSIONS
+// ============================================================================
+
+bool JsonLineScanner::toInt(const Field& field, long long& out) {
+    if (field.kind != ValueKind::Number) return false;
+    const char* end = field.value.data() + field.value.size();
+    auto result = std::from_chars(field.value.data(), end, out);
+    if (result.ec == std::errc() && result.ptr == end) return true;
+
+    // Accept integral values written as floating point ("3.0", "1e3")
+    double value;
+    if (!toDouble(field, value)) return false;
+    // -2^63 is exact as a double; 2^63 is the first value past the top
+    constexpr double LOWEST = static_cast<double>(std::numeric_limits<long long>::min());
+    if (!(value >= LOWEST && value < -LOWEST)) return false;
+    out = static_cast<long long>(value);
+    return out == value;
+}
+
+bool JsonLineScanner::toDouble(const Field& field, double& out) {
+    if (field.kind != ValueKind::Number) return false;
+    const char* end = field.value.data() + field.value.size();
+    auto result = std::from_chars(field.value.data(), end, out);
+    return result.ec == std::errc() && result.ptr == end;
+}
+
+bool JsonLineScanner::toBool(const Field& field, bool& out) {
+    if (field.kind == ValueKind::Bool) {
+        out = (field.value == "true");
+        return true;
+    }
+    // Tolerate 0/1 like the CSV files use
+    long long value;
+    if (!toInt(field, value)) return false;
+    out = (value != 0);
+    return true;
+}
+
+std::string JsonLineScanner::toString(const Field& field) {
+    return field.escaped ? unescape(field.value) : std::string(field.value);
+}
+
+std::string JsonLineScanner::unescape(std::string_view raw) {
+    std::string out;
+    out.reserve(raw.size());
+
+    for (std::size_t i = 0; i < raw.size(); i++) {
+        if (raw[i] != '\\' || i + 1 >= raw.size()) {
+            out += raw[i];
+            continue;
+        }
+
+        char c = raw[++i];
+        switch (c) {
+            case 'n': out += '\n'; break;
+            case 't': out += '\t'; break;
+            case 'r': out += '\r'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'u': {
+                // Basic Multilingual Plane code point, encoded as UTF-8
+                unsigned code = 0;
+                if (i + 4 >= raw.size()) {
+                    out += 'u';
+                    break;
+                }
+                auto result = std::from_chars(raw.data() + i + 1, raw.data() + i + 5, code, 16);
+                if (result.ec != std::errc()) {
+                    out += 'u';
+                    break;
+                }
+                i += 4;
+                if (code < 0x80) {
+                    out += static_cast<char>(code);
+                } else if (code < 0x800) {
+                    out += static_cast<char>(0xC0 | (code >> 6));
+                    out += static_cast<char>(0x80 | (code & 0x3F));
+                } else {
+                    out += static_cast<char>(0xE0 | (code >> 12));
+                    out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                    out += static_cast<char>(0x80 | (code & 0x3F));
+                }
+                break;
+            }
+            default: out += c; break;  // \" \\ \/
+        }
+    }
+    return out;
+}
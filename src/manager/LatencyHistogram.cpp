@@ -0,0 +1,56 @@
+#include "LatencyHistogram.hpp"
+
+#include <algorithm>
+#include <bit>
+
+void LatencyHistogram::record(std::chrono::nanoseconds latency) {
+    std::uint64_t ns = latency.count() > 0 ? static_cast<std::uint64_t>(latency.count()) : 0;
+
+    // Index of the highest set bit, samples under 1 ns land in bucket 0
+    int bucket = ns == 0 ? 0 : static_cast<int>(std::bit_width(ns)) - 1;
+    buckets[std::min(bucket, BUCKETS - 1)]++;
+
+    count++;
+    total_ns += ns;
+    max_ns = std::max(max_ns, ns);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (int i = 0; i < BUCKETS; i++) {
+        buckets[i] += other.buckets[i];
+    }
+    count += other.count;
+    total_ns += other.total_ns;
+    max_ns = std::max(max_ns, other.max_ns);
+}
+
+void LatencyHistogram::reset() { *this = LatencyHistogram{}; }
+
+std::uint64_t LatencyHistogram::getCount() const { return count; }
+std::chrono::nanoseconds LatencyHistogram::getMax() const { return std::chrono::nanoseconds(max_ns); }
+std::chrono::nanoseconds LatencyHistogram::getTotal() const { return std::chrono::nanoseconds(total_ns); }
+
+std::chrono::nanoseconds LatencyHistogram::getMean() const {
+    if (count == 0) return std::chrono::nanoseconds(0);
+    return std::chrono::nanoseconds(total_ns / count);
+}
+
+std::chrono::nanoseconds LatencyHistogram::percentile(double p) const {
+    if (count == 0) return std::chrono::nanoseconds(0);
+
+    std::uint64_t rank = static_cast<std::uint64_t>(p / 100.0 * count);
+    if (rank >= count) rank = count - 1;
+
+    std::uint64_t seen = 0;
+    for (int i = 0; i < BUCKETS; i++) {
+        seen += buckets[i];
+        if (seen > rank) {
+            // Never report more than the largest sample actually seen
+            std::uint64_t upper = (std::uint64_t{1} << (i + 1)) - 1;
+            return std::chrono::nanoseconds(std::min(upper, max_ns));
+        }
+    }
+    return std::chrono::nanoseconds(max_ns);
+}
+
+const std::array<std::uint64_t, LatencyHistogram::BUCKETS>& LatencyHistogram::getBuckets() const { return buckets; }
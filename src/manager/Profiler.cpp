@@ -0,0 +1,50 @@
+#include "Profiler.hpp"
+#include <fstream>
+#include <iostream>
+
+const ProfileSnapshot& Profiler::getSnapshot() const { return data; }
+
+void Profiler::reset() { data = ProfileSnapshot{}; }
+
+bool Profiler::dump(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open " << filename << " for writing.\n";
+        return false;
+    }
+
+    auto us = [](std::chrono::nanoseconds ns) { return ns.count() / 1000.0; };
+
+    file << "Kind,Name,Count,Total (us),Mean (us),p50 (us),p99 (us),Max (us)\n";
+    for (std::size_t i = 0; i < data.phases.size(); i++) {
+        const LatencyHistogram& h = data.phases[i];
+        file << "Phase," << phaseName(static_cast<ProfilePhase>(i)) << "," << h.getCount() << ","
+             << us(h.getTotal()) << "," << us(h.getMean()) << "," << us(h.percentile(50)) << ","
+             << us(h.percentile(99)) << "," << us(h.getMax()) << "\n";
+    }
+    for (std::size_t i = 0; i < data.counters.size(); i++) {
+        file << "Counter," << counterName(static_cast<ProfileCounter>(i)) << "," << data.counters[i] << ",,,,,\n";
+    }
+
+    file.close();
+    return true;
+}
+
+const char* Profiler::phaseName(ProfilePhase phase) {
+    switch (phase) {
+        case ProfilePhase::Tick: return "Tick";
+        case ProfilePhase::CheckReceived: return "CheckReceived";
+        case ProfilePhase::AutoAssign: return "AutoAssign";
+        case ProfilePhase::TechnicianTick: return "TechnicianTick";
+        default: return "Unknown";
+    }
+}
+
+const char* Profiler::counterName(ProfileCounter counter) {
+    switch (counter) {
+        case ProfileCounter::RequestLookups: return "RequestLookups";
+        case ProfileCounter::EmployeeLookups: return "EmployeeLookups";
+        case ProfileCounter::Assignments: return "Assignments";
+        default: return "Unknown";
+    }
+}
@@ -0,0 +1,184 @@
+#include "SchedulingPolicy.hpp"
+#include "RepairRequest.hpp"
+#include "BrandRegistry.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <tuple>
+
+// ============================================================================
+// POLICY SELECTION
+// ============================================================================
+
+void SchedulingPolicy::onAssigned(const RepairRequest&) {}
+void SchedulingPolicy::reset() {}
+
+std::unique_ptr<SchedulingPolicy> SchedulingPolicy::create(SchedulingPolicyKind kind) {
+    switch (kind) {
+        case SchedulingPolicyKind::FirstCome: return std::make_unique<FirstComePolicy>();
+        case SchedulingPolicyKind::ShortestRepair: return std::make_unique<ShortestRepairPolicy>();
+        case SchedulingPolicyKind::HighestPrice: return std::make_unique<HighestPricePolicy>();
+        case SchedulingPolicyKind::Aging: return std::make_unique<AgingPolicy>();
+        case SchedulingPolicyKind::FairShare: return std::make_unique<FairSharePolicy>();
+    }
+    return std::make_unique<FirstComePolicy>();
+}
+
+std::optional<SchedulingPolicyKind> SchedulingPolicy::parseKind(std::string_view name) {
+    for (SchedulingPolicyKind kind : allKinds()) {
+        if (name == kindName(kind)) return kind;
+    }
+    return std::nullopt;
+}
+
+const char* SchedulingPolicy::kindName(SchedulingPolicyKind kind) {
+    switch (kind) {
+        case SchedulingPolicyKind::FirstCome: return "first-come";
+        case SchedulingPolicyKind::ShortestRepair: return "shortest-repair";
+        case SchedulingPolicyKind::HighestPrice: return "highest-price";
+        case SchedulingPolicyKind::Aging: return "aging";
+        case SchedulingPolicyKind::FairShare: return "fair-share";
+    }
+    return "unknown";
+}
+
+const std::vector<SchedulingPolicyKind>& SchedulingPolicy::allKinds() {
+    static const std::vector<SchedulingPolicyKind> kinds = {
+        SchedulingPolicyKind::FirstCome,
+        SchedulingPolicyKind::ShortestRepair,
+        SchedulingPolicyKind::HighestPrice,
+        SchedulingPolicyKind::Aging,
+        SchedulingPolicyKind::FairShare
+    };
+    return kinds;
+}
+
+// ============================================================================
+// ORDERING POLICIES
+// ============================================================================
+
+// Ties always fall back to the request id, so every policy is deterministic
+
+SchedulingPolicyKind FirstComePolicy::kind() const { return SchedulingPolicyKind::FirstCome; }
+
+void FirstComePolicy::order(std::vector<RepairRequest*>&) {
+    // Already in id order
+}
+
+long long FirstComePolicy::skillKey(const RepairRequest&) const { return 0; }
+
+SchedulingPolicyKind ShortestRepairPolicy::kind() const { return SchedulingPolicyKind::ShortestRepair; }
+
+void ShortestRepairPolicy::order(std::vector<RepairRequest*>& pending) {
+    std::stable_sort(pending.begin(), pending.end(), [](const RepairRequest* a, const RepairRequest* b) {
+        return a->getRepairDuration() < b->getRepairDuration();
+    });
+}
+
+long long ShortestRepairPolicy::skillKey(const RepairRequest& request) const { return request.getRepairDuration(); }
+
+SchedulingPolicyKind HighestPricePolicy::kind() const { return SchedulingPolicyKind::HighestPrice; }
+
+void HighestPricePolicy::order(std::vector<RepairRequest*>& pending) {
+    std::stable_sort(pending.begin(), pending.end(), [](const RepairRequest* a, const RepairRequest* b) {
+        return a->getPrice() > b->getPrice();
+    });
+}
+
+long long HighestPricePolicy::skillKey(const RepairRequest& request) const { return -request.getPrice(); }
+
+SchedulingPolicyKind AgingPolicy::kind() const { return SchedulingPolicyKind::Aging; }
+
+void AgingPolicy::order(std::vector<RepairRequest*>& pending) {
+    std::stable_sort(pending.begin(), pending.end(), [](const RepairRequest* a, const RepairRequest* b) {
+        return a->getTimestamp() < b->getTimestamp();
+    });
+}
+
+long long AgingPolicy::skillKey(const RepairRequest& request) const {
+    return request.getTimestamp().time_since_epoch().count();
+}
+
+// ============================================================================
+// FAIR SHARE ACROSS BRANDS
+// ============================================================================
+
+SchedulingPolicyKind FairSharePolicy::kind() const { return SchedulingPolicyKind::FairShare; }
+
+double FairSharePolicy::weightOf(int brand_id) const {
+    std::size_t index = static_cast<std::size_t>(brand_id);
+    return index < weights.size() && weights[index] > 0 ? weights[index] : 1.0;
+}
+
+double FairSharePolicy::startTagOf(int brand_id) const {
+    std::size_t index = static_cast<std::size_t>(brand_id);
+    double finish = index < finish_tags.size() ? finish_tags[index] : 0.0;
+    return std::max(finish, virtual_time);
+}
+
+void FairSharePolicy::order(std::vector<RepairRequest*>& pending) {
+    for (int brand : active_brands) by_brand[brand].clear();
+    active_brands.clear();
+
+    // Requests whose brand was never registered (never stored by the
+    // manager) have no share to keep; they go last, in id order
+    unregistered.clear();
+    for (RepairRequest* request : pending) {
+        int brand_id = request->getAppliance().getBrandId();
+        if (brand_id == Appliance::UNREGISTERED_BRAND) {
+            unregistered.push_back(request);
+            continue;
+        }
+        std::size_t brand = static_cast<std::size_t>(brand_id);
+        if (brand >= by_brand.size()) by_brand.resize(brand + 1);
+        if (by_brand[brand].empty()) active_brands.push_back(static_cast<int>(brand));
+        by_brand[brand].push_back(request);
+    }
+
+    // (start tag, id of the brand's next request, brand, position in its queue)
+    using Entry = std::tuple<double, int, int, std::size_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heads;
+    for (int brand : active_brands) {
+        heads.emplace(startTagOf(brand), by_brand[brand].front()->getId(), brand, 0);
+    }
+
+    // Assume each request will be assigned when computing the next tags;
+    // the real tags only move in onAssigned()
+    std::size_t out = 0;
+    while (!heads.empty()) {
+        auto [tag, id, brand, position] = heads.top();
+        heads.pop();
+        const auto& queue = by_brand[brand];
+        pending[out++] = queue[position];
+        if (++position < queue.size()) {
+            heads.emplace(tag + 1.0 / weightOf(brand), queue[position]->getId(), brand, position);
+        }
+    }
+    for (RepairRequest* request : unregistered) pending[out++] = request;
+}
+
+void FairSharePolicy::onAssigned(const RepairRequest& request) {
+    int brand = request.getAppliance().getBrandId();
+    if (brand == Appliance::UNREGISTERED_BRAND) return;
+    std::size_t index = static_cast<std::size_t>(brand);
+    if (index >= finish_tags.size()) finish_tags.resize(index + 1, 0.0);
+
+    double start = startTagOf(brand);
+    virtual_time = start;
+    finish_tags[index] = start + 1.0 / weightOf(brand);
+}
+
+// Each brand's queue is served in id order, and a skill belongs to one brand
+long long FairSharePolicy::skillKey(const RepairRequest&) const { return 0; }
+
+void FairSharePolicy::reset() {
+    finish_tags.clear();
+    virtual_time = 0.0;
+}
+
+void FairSharePolicy::setWeight(const std::string& brand, double weight) {
+    std::size_t index = static_cast<std::size_t>(BrandRegistry::intern(brand));
+    if (index >= weights.size()) weights.resize(index + 1, 1.0);
+    weights[index] = weight;
+}
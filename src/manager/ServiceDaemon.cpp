@@ -0,0 +1,651 @@
+// ServiceDaemon.cpp
+#include "ServiceDaemon.hpp"
+#include "ApplianceFactory.hpp"
+#include "Profiler.hpp"
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <csignal>
+#include <cerrno>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+#include <poll.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+namespace {
+    // Set from SIGINT / SIGTERM, polled by the serve loop
+    volatile std::sig_atomic_t stopRequested = 0;
+
+    void handleStopSignal(int) { stopRequested = 1; }
+
+    bool setNonBlocking(int fd) {
+        int flags = fcntl(fd, F_GETFL);
+        return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+    }
+
+    // Upper bound on a client's unterminated line, so a peer that never sends
+    // a newline cannot grow the buffer without limit
+    constexpr std::size_t MAX_PENDING_INPUT = 64 * 1024;
+    // Replies queued for a client; past this, its input is not read until it
+    // catches up, so a peer that pipelines without reading only blocks itself
+    constexpr std::size_t MAX_PENDING_OUTPUT = 256 * 1024;
+    // TICK runs under the manager lock; a larger count would stall the
+    // background ticks and every other client until it finished
+    constexpr int MAX_TICKS_PER_COMMAND = 1000;
+}
+
+ServiceDaemon::ServiceDaemon(ServiceManager& mgr, RepairRequestFactory& reqFactory, std::string path)
+    : manager(mgr), requestFactory(reqFactory), socketPath(std::move(path)) {}
+
+ServiceDaemon::~ServiceDaemon() {
+    stop();
+    if (tickThread.joinable()) {
+        tickThread.join();
+    }
+    closeSocket();
+}
+
+// ============================================================================
+// LIFECYCLE
+// ============================================================================
+
+bool ServiceDaemon::start() {
+    if (!openSocket()) {
+        return false;
+    }
+
+    struct sigaction action{};
+    action.sa_handler = handleStopSignal;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, nullptr);
+    sigaction(SIGTERM, &action, nullptr);
+    // A client hanging up mid-write must not kill the daemon
+    std::signal(SIGPIPE, SIG_IGN);
+
+    std::cout << "Service daemon listening on " << socketPath << std::endl;
+
+    tickThread = std::thread(&ServiceDaemon::tickLoop, this);
+    serveLoop();
+
+    stop();
+    if (tickThread.joinable()) {
+        tickThread.join();
+    }
+    closeSocket();
+
+    std::cout << "Service daemon stopped" << std::endl;
+    return true;
+}
+
+void ServiceDaemon::stop() {
+    running = false;
+    scheduler.stop();
+}
+
+void ServiceDaemon::tickLoop() {
+    using namespace std::chrono;
+
+    while (running && scheduler.waitForNextTick()) {
+        auto start = steady_clock::now();
+
+        {
+            std::lock_guard<std::mutex> lock(managerMutex);
+            manager.tick();
+        }
+
+        scheduler.recordTick(steady_clock::now() - start);
+    }
+}
+
+void ServiceDaemon::serveLoop() {
+    std::vector<pollfd> fds;
+
+    while (running && !stopRequested) {
+        fds.clear();
+        fds.push_back({listenFd, POLLIN, 0});
+        for (const auto& client : clients) {
+            short events = (client.closing || client.output.size() >= MAX_PENDING_OUTPUT) ? 0 : POLLIN;
+            if (!client.output.empty()) events |= POLLOUT;
+            fds.push_back({client.fd, events, 0});
+        }
+
+        // Wake up periodically so stop requests are noticed promptly
+        int ready = poll(fds.data(), fds.size(), 250);
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            std::cerr << "poll failed: " << std::strerror(errno) << std::endl;
+            break;
+        }
+
+        // Clients first: the indices in fds match the clients vector
+        // only until acceptClients() appends to it
+        for (std::size_t i = 0; i < clients.size(); i++) {
+            Client& client = clients[i];
+            short revents = fds[i + 1].revents;
+            bool alive = true;
+
+            if (revents & (POLLIN | POLLHUP | POLLERR)) {
+                alive = readClient(client);
+            }
+            if (alive && !client.output.empty()) {
+                alive = writeClient(client);
+            }
+            if (alive && client.closing && client.output.empty()) {
+                alive = false;
+            }
+            if (!alive) {
+                close(client.fd);
+                client.fd = -1;
+            }
+        }
+        clients.erase(std::remove_if(clients.begin(), clients.end(),
+                                     [](const Client& c) { return c.fd < 0; }),
+                      clients.end());
+
+        if (fds[0].revents & POLLIN) {
+            acceptClients();
+        }
+    }
+
+    // Flush whatever is still queued (e.g. the reply to SHUTDOWN)
+    for (auto& client : clients) {
+        writeClient(client);
+        close(client.fd);
+    }
+    clients.clear();
+}
+
+// ============================================================================
+// SOCKET HANDLING
+// ============================================================================
+
+bool ServiceDaemon::openSocket() {
+    sockaddr_un address{};
+    if (socketPath.empty() || socketPath.size() >= sizeof(address.sun_path)) {
+        std::cerr << "Invalid socket path: " << socketPath << std::endl;
+        return false;
+    }
+
+    listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0) {
+        std::cerr << "socket failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+    // Only a stale socket left behind by a previous run may be replaced
+    struct stat existing{};
+    if (lstat(socketPath.c_str(), &existing) == 0) {
+        if (!S_ISSOCK(existing.st_mode)) {
+            std::cerr << "Cannot listen on " << socketPath << ": path exists and is not a socket" << std::endl;
+            close(listenFd);
+            listenFd = -1;
+            return false;
+        }
+        if (connect(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) {
+            std::cerr << "Cannot listen on " << socketPath << ": another daemon is listening there" << std::endl;
+            close(listenFd);
+            listenFd = -1;
+            return false;
+        }
+        // The failed connect leaves the socket unusable for bind on some systems
+        close(listenFd);
+        listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listenFd < 0) {
+            std::cerr << "socket failed: " << std::strerror(errno) << std::endl;
+            return false;
+        }
+        unlink(socketPath.c_str());
+    }
+
+    if (bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 ||
+        listen(listenFd, 16) < 0 || !setNonBlocking(listenFd)) {
+        std::cerr << "Cannot listen on " << socketPath << ": " << std::strerror(errno) << std::endl;
+        close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+
+    return true;
+}
+
+void ServiceDaemon::closeSocket() {
+    if (listenFd >= 0) {
+        close(listenFd);
+        listenFd = -1;
+        unlink(socketPath.c_str());
+    }
+}
+
+void ServiceDaemon::acceptClients() {
+    while (true) {
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0) {
+            return;  // EAGAIN once the backlog is drained
+        }
+        if (!setNonBlocking(fd)) {
+            close(fd);
+            continue;
+        }
+        clients.push_back(Client{fd, {}, {}});
+    }
+}
+
+bool ServiceDaemon::readClient(Client& client) {
+    char buffer[4096];
+
+    while (client.output.size() < MAX_PENDING_OUTPUT) {
+        ssize_t count = read(client.fd, buffer, sizeof(buffer));
+        if (count > 0) {
+            // Complete lines are answered as they arrive, so only the
+            // unterminated tail counts against the limit
+            client.input.append(buffer, static_cast<std::size_t>(count));
+            processLines(client);
+            if (client.input.size() > MAX_PENDING_INPUT) {
+                return false;
+            }
+            continue;
+        }
+        if (count == 0) {
+            // Peer closed its end; answer what it already sent, then drop it
+            client.closing = true;
+            return true;
+        }
+        if (errno == EINTR) continue;
+        return errno == EAGAIN || errno == EWOULDBLOCK;
+    }
+    return true;
+}
+
+bool ServiceDaemon::writeClient(Client& client) {
+    while (!client.output.empty()) {
+        ssize_t count = write(client.fd, client.output.data(), client.output.size());
+        if (count > 0) {
+            client.output.erase(0, static_cast<std::size_t>(count));
+            continue;
+        }
+        if (count < 0 && errno == EINTR) continue;
+        return count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+    }
+    return true;
+}
+
+// ============================================================================
+// PROTOCOL
+// ============================================================================
+
+void ServiceDaemon::processLines(Client& client) {
+    std::size_t lineEnd = client.input.find('\n');
+    if (lineEnd == std::string::npos) {
+        return;
+    }
+
+    // The whole batch runs under one lock so it observes a single tick
+    std::lock_guard<std::mutex> lock(managerMutex);
+
+    std::size_t lineStart = 0;
+    while (lineEnd != std::string::npos) {
+        std::string line = client.input.substr(lineStart, lineEnd - lineStart);
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+
+        if (!line.empty() && !client.closing) {
+            client.output += executeCommand(line, client);
+            client.output += '\n';
+        }
+
+        lineStart = lineEnd + 1;
+        lineEnd = client.input.find('\n', lineStart);
+    }
+    client.input.erase(0, lineStart);
+}
+
+std::string ServiceDaemon::executeCommand(const std::string& line, Client& client) {
+    std::istringstream args(line);
+    std::string command;
+    args >> command;
+    std::transform(command.begin(), command.end(), command.begin(), ::toupper);
+
+    try {
+        if (command == "PING") return "OK PONG";
+        if (command == "ADD") return commandAdd(args);
+        if (command == "STATUS") return commandStatus(args);
+        if (command == "STATS") return commandStats();
+        if (command == "TICK") return commandTick(args);
+        if (command == "SPEED") return commandSpeed(args);
+        if (command == "PROFILE") return commandProfile(args);
+        if (command == "POLICY") return commandPolicy(args);
+        if (command == "ASSIGN") return commandAssign(args);
+        if (command == "REPORT") return commandReport(args);
+        if (command == "LOAD") return commandLoad(args);
+        if (command == "IMPORT") return commandImport(args);
+        if (command == "SAVE") return commandSave(args);
+        if (command == "QUIT") {
+            client.closing = true;
+            return "OK BYE";
+        }
+        if (command == "SHUTDOWN") {
+            running = false;
+            return "OK SHUTDOWN";
+        }
+    } catch (const std::exception& e) {
+        return std::string("ERR ") + e.what();
+    }
+
+    return "ERR unknown command " + command;
+}
+
+std::string ServiceDaemon::commandAdd(std::istringstream& args) {
+    std::string typeName, brand, model;
+    int year, price, complexity, receptionistId;
+    if (!(args >> typeName >> brand >> model >> year >> price >> complexity >> receptionistId)) {
+        return "ERR usage: ADD <type> <brand> <model> <year> <price> <complexity> <receptionist_id> <details...>";
+    }
+    if (complexity < 1 || complexity > 5) {
+        return "ERR complexity must be between 1 and 5";
+    }
+
+    Employee* receptionist = manager.findEmployeeById(receptionistId);
+    if (!receptionist || receptionist->getType() != EmployeeType::Receptionist) {
+        return "ERR no receptionist with id " + std::to_string(receptionistId);
+    }
+
+    std::unique_ptr<Appliance> appliance;
+    switch (stringToApplianceType(typeName)) {
+        case ApplianceType::Fridge: {
+            int hasFreezer;
+            if (!(args >> hasFreezer)) return "ERR Fridge needs <has_freezer 0|1>";
+            appliance = ApplianceFactory::createApplianceFridge(brand, model, year, price, hasFreezer != 0);
+            break;
+        }
+        case ApplianceType::TV: {
+            double diagonal;
+            std::string unit;
+            if (!(args >> diagonal >> unit) || (unit != "cm" && unit != "inch")) {
+                return "ERR TV needs <diagonal> <cm|inch>";
+            }
+            DiagonalUnit diagUnit = (unit == "cm") ? DiagonalUnit::Centimeters : DiagonalUnit::Inches;
+            appliance = ApplianceFactory::createApplianceTV(brand, model, year, price, diagonal, diagUnit);
+            break;
+        }
+        case ApplianceType::WashingMachine: {
+            double capacity;
+            if (!(args >> capacity)) return "ERR WashingMachine needs <capacity>";
+            appliance = ApplianceFactory::createApplianceWashingMachine(brand, model, year, price, capacity);
+            break;
+        }
+    }
+
+    if (!appliance) {
+        return "ERR invalid appliance";
+    }
+
+    // Same duration rule as the interactive menus
+    int repairDuration = appliance->getAge() * complexity;
+    auto request = requestFactory.createRepairRequest(std::move(appliance), complexity,
+                                                      repairDuration, receptionistId);
+    int requestId = request->getId();
+    manager.addRepairRequest(std::move(request));
+
+    return "OK " + std::to_string(requestId);
+}
+
+std::string ServiceDaemon::commandStatus(std::istringstream& args) {
+    int id;
+    if (!(args >> id)) {
+        return "ERR usage: STATUS <request_id>";
+    }
+
+    RepairRequest* request = manager.findRepairRequestById(id);
+    if (!request) {
+        return "ERR no request with id " + std::to_string(id);
+    }
+
+    std::ostringstream out;
+    out << "OK " << request->getId()
+        << " " << statusToString(request->getStatus())
+        << " remaining=" << request->getRemainingTime()
+        << " technician=" << request->getTechnicianId()
+        << " price=" << request->getPrice();
+    return out.str();
+}
+
+std::string ServiceDaemon::commandStats() {
+    ServiceStats stats = manager.getStats();
+
+    std::ostringstream out;
+    out << "OK employees=" << stats.total_employees
+        << " requests=" << stats.total_requests;
+    for (int s = 0; s < 5; s++) {
+        std::string name = statusToString(static_cast<Status>(s));
+        std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+        out << " " << name << "=" << stats.requests_by_status[s];
+    }
+    out << " revenue=" << stats.completed_revenue
+        << " remaining_ticks=" << stats.remaining_ticks
+        << " salaries=" << stats.total_salaries
+        << " ticks=" << stats.tick_count;
+    return out.str();
+}
+
+std::string ServiceDaemon::commandTick(std::istringstream& args) {
+    int count = 1;
+    std::string value;
+    if (args >> value) {
+        char* end = nullptr;
+        long parsed = std::strtol(value.c_str(), &end, 10);
+        if (*end != '\0' || parsed < 1 || parsed > MAX_TICKS_PER_COMMAND) {
+            return "ERR tick count must be between 1 and " + std::to_string(MAX_TICKS_PER_COMMAND);
+        }
+        count = static_cast<int>(parsed);
+    }
+
+    // Runs synchronously, independent of the background pace
+    for (int i = 0; i < count; i++) {
+        manager.tick();
+    }
+    return "OK " + std::to_string(manager.getClock().getTickCount());
+}
+
+std::string ServiceDaemon::commandSpeed(std::istringstream& args) {
+    std::string value;
+    if (!(args >> value)) {
+        return "ERR usage: SPEED <ticks per second|max>";
+    }
+
+    double speed = TickScheduler::MAX_SPEED;
+    if (value != "max") {
+        char* end = nullptr;
+        speed = std::strtod(value.c_str(), &end);
+        if (*end != '\0' || !std::isfinite(speed) || speed < TickScheduler::MIN_SPEED) {
+            return "ERR speed must be a number of ticks per second, at least 0.000001";
+        }
+    }
+    scheduler.setSpeed(speed);
+
+    TickTimingStats timing = scheduler.getTimingStats();
+    std::ostringstream out;
+    out << "OK speed=" << value
+        << " p50_us=" << std::chrono::duration_cast<std::chrono::microseconds>(timing.latency.percentile(50)).count()
+        << " p99_us=" << std::chrono::duration_cast<std::chrono::microseconds>(timing.latency.percentile(99)).count()
+        << " overruns=" << timing.overruns;
+    return out.str();
+}
+
+std::string ServiceDaemon::commandPolicy(std::istringstream& args) {
+    std::string name;
+    if (args >> name) {
+        std::optional<SchedulingPolicyKind> kind = SchedulingPolicy::parseKind(name);
+        if (!kind) {
+            std::string usage = "ERR usage: POLICY [";
+            for (SchedulingPolicyKind k : SchedulingPolicy::allKinds()) {
+                if (k != SchedulingPolicy::allKinds().front()) usage += "|";
+                usage += SchedulingPolicy::kindName(k);
+            }
+            return usage + "] [<brand>=<weight>...]";
+        }
+
+        // Fair share takes per-brand weights, e.g. POLICY fair-share Samsung=2 LG=0.5.
+        // All of them are checked before any brand is registered or the
+        // running policy is replaced.
+        std::vector<std::pair<std::string, double>> weights;
+        std::string weight_arg;
+        while (args >> weight_arg) {
+            if (*kind != SchedulingPolicyKind::FairShare) {
+                return "ERR only fair-share takes brand weights";
+            }
+            std::size_t equals = weight_arg.rfind('=');
+            if (equals == std::string::npos || equals == 0 || equals + 1 == weight_arg.size()) {
+                return "ERR weights are written <brand>=<weight>";
+            }
+            const char* value = weight_arg.c_str() + equals + 1;
+            char* end = nullptr;
+            double weight = std::strtod(value, &end);
+            if (*end != '\0' || !(weight > 0) || !std::isfinite(weight)) {
+                return "ERR weight of " + weight_arg.substr(0, equals) + " must be a positive number";
+            }
+            weights.emplace_back(weight_arg.substr(0, equals), weight);
+        }
+
+        std::unique_ptr<SchedulingPolicy> policy = SchedulingPolicy::create(*kind);
+        for (const auto& [brand, weight] : weights) {
+            static_cast<FairSharePolicy&>(*policy).setWeight(brand, weight);
+        }
+        manager.setSchedulingPolicy(std::move(policy));
+    }
+    return std::string("OK policy=") + SchedulingPolicy::kindName(manager.getSchedulingPolicy().kind());
+}
+
+std::string ServiceDaemon::commandAssign(std::istringstream& args) {
+    std::string mode;
+    if (args >> mode) {
+        if (mode == "greedy") {
+            manager.setAssignmentMode(AssignmentMode::Greedy);
+        } else if (mode == "batch") {
+            long long budget = 2000;
+            std::string value;
+            if (args >> value) budget = std::stoll(value);
+            if (budget <= 0) {
+                return "ERR budget must be positive";
+            }
+            manager.setAssignmentMode(AssignmentMode::Batch, std::chrono::microseconds{budget});
+        } else {
+            return "ERR usage: ASSIGN [greedy|batch [budget_us]]";
+        }
+    }
+
+    std::ostringstream out;
+    if (manager.getAssignmentMode() == AssignmentMode::Batch) {
+        out << "OK assign=batch budget_us=" << manager.getBatchBudget().count()
+            << " timeouts=" << manager.getStats().batch_timeouts;
+    } else {
+        out << "OK assign=greedy";
+    }
+    return out.str();
+}
+
+std::string ServiceDaemon::commandProfile(std::istringstream& args) {
+    if (!Profiler::isEnabled()) {
+        return "ERR profiling is compiled out";
+    }
+
+    Profiler& profiler = Profiler::getInstance();
+    std::string action;
+    args >> action;
+
+    if (action == "reset") {
+        profiler.reset();
+        return "OK reset";
+    }
+    if (action == "dump") {
+        std::string filename;
+        if (!(args >> filename)) return "ERR usage: PROFILE dump <filename>";
+        return profiler.dump(filename) ? "OK " + filename : "ERR could not write " + filename;
+    }
+    if (!action.empty()) {
+        return "ERR usage: PROFILE [reset|dump <filename>]";
+    }
+
+    // Compact one-line summary: p99 per phase, then the raw counters
+    const ProfileSnapshot& snapshot = profiler.getSnapshot();
+    std::ostringstream out;
+    out << "OK";
+    for (std::size_t i = 0; i < snapshot.phases.size(); i++) {
+        out << " " << Profiler::phaseName(static_cast<ProfilePhase>(i)) << "_p99_us="
+            << std::chrono::duration_cast<std::chrono::microseconds>(snapshot.phases[i].percentile(99)).count();
+    }
+    for (std::size_t i = 0; i < snapshot.counters.size(); i++) {
+        out << " " << Profiler::counterName(static_cast<ProfileCounter>(i)) << "=" << snapshot.counters[i];
+    }
+    return out.str();
+}
+
+std::string ServiceDaemon::commandReport(std::istringstream& args) {
+    std::string kind, filename;
+    if (!(args >> kind >> filename)) {
+        return "ERR usage: REPORT <top|longest|pending> <filename> [k]";
+    }
+
+    bool ok = false;
+    if (kind == "top") {
+        std::size_t k = 3;
+        args >> k;
+        ok = manager.generateTopSalariesReport(filename, k);
+    } else if (kind == "longest") {
+        ok = manager.generateLongestRepairReport(filename);
+    } else if (kind == "pending") {
+        ok = manager.generatePendingRequestsReport(filename);
+    } else {
+        return "ERR unknown report " + kind;
+    }
+
+    return ok ? "OK " + filename : "ERR could not write " + filename;
+}
+
+std::string ServiceDaemon::commandLoad(std::istringstream& args) {
+    std::string employeesFile = "Employees.csv";
+    std::string requestsFile = "RepairRequests.csv";
+    args >> employeesFile >> requestsFile;
+
+    bool ok = manager.loadFromCSV(requestFactory, employeesFile, requestsFile);
+    return ok ? "OK loaded" : "ERR load failed or skipped rows (see the daemon's error output)";
+}
+
+std::string ServiceDaemon::commandImport(std::istringstream& args) {
+    std::string filename;
+    if (!(args >> filename)) {
+        return "ERR usage: IMPORT <jsonl_file>";
+    }
+
+    std::size_t before = manager.getStats().total_requests;
+    if (!manager.importRepairRequestsFromJSONL(requestFactory, filename)) {
+        return "ERR could not read " + filename;
+    }
+    return "OK " + std::to_string(manager.getStats().total_requests - before);
+}
+
+std::string ServiceDaemon::commandSave(std::istringstream& args) {
+    std::string employeesFile = "Employees.csv";
+    std::string requestsFile = "RepairRequests.csv";
+    args >> employeesFile >> requestsFile;
+
+    bool ok = manager.saveToCSV(employeesFile, requestsFile);
+    return ok ? "OK saved" : "ERR save failed";
+}
+
+std::string ServiceDaemon::statusToString(Status status) {
+    switch (status) {
+        case Status::Received: return "Received";
+        case Status::Pending: return "Pending";
+        case Status::InProgress: return "InProgress";
+        case Status::Completed: return "Completed";
+        case Status::Rejected: return "Rejected";
+        default: return "Unknown";
+    }
+}
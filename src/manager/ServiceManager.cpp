@@ -1,47 +1,413 @@
 #include "ServiceManager.hpp"
+#include "JsonLineScanner.hpp"
+#include "Profiler.hpp"
+#include "CNPValidator.hpp"
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
 
-void ServiceManager::addEmployee(std::unique_ptr<Employee> employee) {
-    employees.push_back(std::move(employee));    
-};
+bool ServiceManager::addEmployee(std::unique_ptr<Employee> employee) {
+    std::optional<std::uint64_t> key = CNPValidator::packKey(employee->getCNP());
+    if (!key || employees_by_cnp.contains(*key) || employee_slots.contains(employee->getId())) {
+        return false;
+    }
+    Employee* raw = employee.release();
+    std::size_t typed_index = 0;
+    switch (raw->getType()) {
+        case EmployeeType::Technician:
+            typed_index = technicians.size();
+            technicians.emplace_back(static_cast<Technician*>(raw));
+            skill_coverage.addAll(technicians.back()->getSkillSet());
+            technicians.back()->getSkillSet().forEach([this](std::size_t skill) { markSkillReady(skill); });
+            break;
+        case EmployeeType::Receptionist:
+            typed_index = receptionists.size();
+            receptionists.emplace_back(static_cast<Receptionist*>(raw));
+            break;
+        case EmployeeType::Supervisor:
+            typed_index = supervisors.size();
+            supervisors.emplace_back(static_cast<Supervisor*>(raw));
+            break;
+    }
+    employees_by_cnp.emplace(*key, raw);
+    employee_slots.emplace(raw->getId(), EmployeeSlot{employees.size(), typed_index});
+    employees.push_back(raw);
+
+    stats.employees_by_type[static_cast<std::size_t>(raw->getType())]++;
+    stats.total_employees++;
+    if (salaries_valid && salaries_computed_on == clock.today()) {
+        total_salaries += raw->getSalary();
+    }
+    touch();
+    return true;
+}
 
 void ServiceManager::addRepairRequest(std::unique_ptr<RepairRequest> repair_request) {
     //repair_request->setStatus(Status::Pending);
+    repair_request->getAppliance().registerBrand();
+
+    // Requests loaded as already completed still count towards their technician's bonus
+    if (repair_request->getStatus() == Status::Completed && repair_request->getTechnicianId() != 0) {
+        Technician* tech = findTechnicianById(repair_request->getTechnicianId());
+        if (tech) {
+            tech->recordCompletedRequest(*repair_request);
+        }
+    }
+
+    indexRequest(*repair_request);
+    stats.total_requests++;
+    requests_by_id[repair_request->getId()] = repair_request.get();
     repair_requests.push_back(std::move(repair_request));
+    touch();
 }
 
-RepairRequest* ServiceManager::findRepairRequestById(int id) const {
-    for (auto& request : repair_requests) {
-        if (request->getId() == id) {
-            return request.get();
+void ServiceManager::addRepairRequests(std::vector<std::unique_ptr<RepairRequest>>& batch) {
+    repair_requests.reserve(repair_requests.size() + batch.size());
+
+    for (auto& repair_request : batch) {
+        repair_request->getAppliance().registerBrand();
+        if (repair_request->getStatus() == Status::Completed && repair_request->getTechnicianId() != 0) {
+            Technician* tech = findTechnicianById(repair_request->getTechnicianId());
+            if (tech) {
+                tech->recordCompletedRequest(*repair_request);
+            }
         }
+
+        indexRequest(*repair_request);
+        stats.total_requests++;
+        // Ids mostly arrive in increasing order, so hint the insertion at the end
+        requests_by_id.emplace_hint(requests_by_id.end(), repair_request->getId(), repair_request.get());
+        repair_requests.push_back(std::move(repair_request));
     }
-    return nullptr; // Not found
+
+    batch.clear();
+    touch();
 }
 
-void ServiceManager::removeEmployeeById(int id) {
-    std::erase_if(employees, [id](const std::unique_ptr<Employee>& emp) {
-        return emp->getId() == id;
-    });
+void ServiceManager::indexRequest(const RepairRequest& request) {
+    stats.requests_by_status[static_cast<std::size_t>(request.getStatus())]++;
+    auto& ids = request_ids_by_status[static_cast<std::size_t>(request.getStatus())];
+    ids.insert(ids.end(), request.getId());
+    if (request.getStatus() == Status::Completed) {
+        stats.completed_revenue += request.getPrice();
+    } else if (request.getStatus() == Status::InProgress) {
+        stats.remaining_ticks += request.getRemainingTime();
+    }
+
+    if (request.getStatus() == Status::Pending) {
+        const Appliance& app = request.getAppliance();
+        ApplianceKeyView key{app.getType(), app.getBrand(), app.getModel()};
+        auto group = pending_groups.find(key);
+        if (group == pending_groups.end()) {
+            group = pending_groups.emplace(ApplianceKey{app.getType(), app.getBrand(), app.getModel()},
+                                           std::set<int>{}).first;
+        }
+        group->second.insert(request.getId());
+
+        std::size_t skill = SkillSet::bitIndex(app);
+        if (skill >= pending_by_skill.size()) pending_by_skill.resize(skill + 1);
+        pending_by_skill[skill].insert({scheduling_policy->skillKey(request), request.getId()});
+        markSkillReady(skill);
+    } else if (request.getStatus() == Status::InProgress) {
+        in_progress_by_duration.insert({request.getRepairDuration(), request.getId()});
+    }
 }
 
-Employee* ServiceManager::findEmployeeById(int id){
-    for (auto& employee : employees) {
-        if (employee->getId() == id) {
-            return employee.get();
+void ServiceManager::unindexRequest(const RepairRequest& request, Status status) {
+    stats.requests_by_status[static_cast<std::size_t>(status)]--;
+    request_ids_by_status[static_cast<std::size_t>(status)].erase(request.getId());
+    if (status == Status::Completed) {
+        stats.completed_revenue -= request.getPrice();
+    } else if (status == Status::InProgress) {
+        stats.remaining_ticks -= request.getRemainingTime();
+    }
+
+    if (status == Status::Pending) {
+        const Appliance& app = request.getAppliance();
+        auto group = pending_groups.find(ApplianceKeyView{app.getType(), app.getBrand(), app.getModel()});
+        if (group != pending_groups.end()) {
+            group->second.erase(request.getId());
+            if (group->second.empty()) {
+                pending_groups.erase(group);
+            }
+        }
+        pending_by_skill[SkillSet::bitIndex(app)].erase({scheduling_policy->skillKey(request), request.getId()});
+    } else if (status == Status::InProgress) {
+        in_progress_by_duration.erase({request.getRepairDuration(), request.getId()});
+
+        // Its technician now has a free slot for every skill they have
+        if (Technician* tech = findTechnicianById(request.getTechnicianId())) {
+            tech->getSkillSet().forEach([this](std::size_t skill) { markSkillReady(skill); });
         }
     }
-    return nullptr; // Not found
 }
 
-Employee* ServiceManager::findEmployeeByCNP(std::string CNP){
-    for (auto& employee : employees) {
-        if (employee->getCNP() == CNP) {
-            return employee.get();
+void ServiceManager::markSkillReady(std::size_t skill) {
+    // Buckets without pending requests are marked when a request arrives
+    if (skill >= pending_by_skill.size() || pending_by_skill[skill].empty()) return;
+    if (skill >= skill_ready.size()) skill_ready.resize(pending_by_skill.size(), false);
+    if (!skill_ready[skill]) {
+        skill_ready[skill] = true;
+        ready_skills.push_back(skill);
+    }
+}
+
+std::size_t ServiceManager::freeSlotsFor(std::size_t skill) const {
+    std::size_t free_slots = 0;
+    for (const auto& tech : technicians) {
+        if (tech->getSkillSet().contains(skill)) {
+            free_slots += std::max(0, MAX_ACTIVE_REQUESTS - tech->getActiveRequestsCount());
+        }
+    }
+    return free_slots;
+}
+
+void ServiceManager::onSkillAdded(const Technician& technician, ApplianceType type, int brand_id) {
+    if (findTechnicianById(technician.getId()) != &technician) return;
+    skill_coverage.add(type, brand_id);
+    markSkillReady(SkillSet::bitIndex(type, brand_id));
+}
+
+void ServiceManager::onStatusChanged(const RepairRequest& request, Status old_status) {
+    if (old_status == request.getStatus()) return;
+
+    unindexRequest(request, old_status);
+    indexRequest(request);
+    touch();
+}
+
+void ServiceManager::onRequestTicked(const RepairRequest& request, Status old_status) {
+    // The request lost one tick of remaining work while still in progress
+    if (old_status == Status::InProgress) {
+        stats.remaining_ticks--;
+        touch();
+    }
+    onStatusChanged(request, old_status);
+}
+
+void ServiceManager::invalidateSalaryTotals() {
+    salaries_valid = false;
+    touch();
+}
+
+void ServiceManager::onSalaryChanged(const Employee& employee, long long delta) {
+    // Employees not (yet) managed are not part of the total
+    auto slot = employee_slots.find(employee.getId());
+    if (slot == employee_slots.end() || employees[slot->second.index] != &employee) return;
+    // A stale total is re-summed on the next read anyway
+    if (salaries_valid && salaries_computed_on == clock.today()) {
+        total_salaries += delta;
+    }
+    touch();
+}
+
+void ServiceManager::touch() {
+    generation.fetch_add(1, std::memory_order_release);
+
+    if (change_listener_armed.load(std::memory_order_relaxed) &&
+        change_listener_armed.exchange(false, std::memory_order_acq_rel) &&
+        change_listener) {
+        change_listener();
+    }
+}
+
+void ServiceManager::setChangeListener(std::function<void()> listener) {
+    change_listener_armed = false;
+    change_listener = std::move(listener);
+}
+
+void ServiceManager::armChangeListener() { change_listener_armed = true; }
+
+std::uint64_t ServiceManager::getGeneration() const { return generation.load(std::memory_order_acquire); }
+
+ServiceStats ServiceManager::getStats() const {
+    std::chrono::year_month_day today = clock.today();
+    if (!salaries_valid || salaries_computed_on != today) {
+        total_salaries = 0;
+        for (const auto& emp : employees) {
+            total_salaries += emp->getSalary();
         }
+        salaries_computed_on = today;
+        salaries_valid = true;
+    }
+
+    ServiceStats snapshot = stats;
+    snapshot.total_salaries = total_salaries;
+    snapshot.tick_count = clock.getTickCount();
+    return snapshot;
+}
+
+void ServiceManager::setRequestStatus(RepairRequest& request, Status new_status) {
+    Status old_status = request.getStatus();
+    request.setStatus(new_status);
+    onStatusChanged(request, old_status);
+}
+
+RepairRequest* ServiceManager::findRepairRequestById(int id) const {
+    PROFILE_COUNT(RequestLookups);
+    auto it = requests_by_id.find(id);
+    if (it != requests_by_id.end()) {
+        return it->second;
     }
     return nullptr; // Not found
 }
 
+std::vector<const RepairRequest*> ServiceManager::getRequestsFrom(
+        int from_id, std::size_t limit, std::optional<Status> status) const
+{
+    std::vector<const RepairRequest*> page;
+    page.reserve(limit);
+
+    if (status) {
+        const std::set<int>& ids = request_ids_by_status[static_cast<std::size_t>(*status)];
+        for (auto it = ids.lower_bound(from_id); it != ids.end() && page.size() < limit; ++it) {
+            page.push_back(findRepairRequestById(*it));
+        }
+    } else {
+        for (auto it = requests_by_id.lower_bound(from_id); it != requests_by_id.end() && page.size() < limit; ++it) {
+            page.push_back(it->second);
+        }
+    }
+    return page;
+}
+
+std::vector<const RepairRequest*> ServiceManager::getRequestsBefore(
+        int before_id, std::size_t limit, std::optional<Status> status) const
+{
+    // Walks backwards from the cursor, then restores ascending id order
+    std::vector<const RepairRequest*> page;
+    page.reserve(limit);
+
+    if (status) {
+        const std::set<int>& ids = request_ids_by_status[static_cast<std::size_t>(*status)];
+        for (auto it = ids.lower_bound(before_id); it != ids.begin() && page.size() < limit; ) {
+            --it;
+            page.push_back(findRepairRequestById(*it));
+        }
+    } else {
+        for (auto it = requests_by_id.lower_bound(before_id); it != requests_by_id.begin() && page.size() < limit; ) {
+            --it;
+            page.push_back(it->second);
+        }
+    }
+    std::reverse(page.begin(), page.end());
+    return page;
+}
+
+std::size_t ServiceManager::countRequests(std::optional<Status> status) const {
+    if (status) {
+        return stats.requests_by_status[static_cast<std::size_t>(*status)];
+    }
+    return stats.total_requests;
+}
+
+bool ServiceManager::removeEmployeeById(int id) {
+    auto slot = employee_slots.find(id);
+    if (slot == employee_slots.end()) return false;
+
+    EmployeeSlot position = slot->second;
+    Employee* emp = employees[position.index];
+    EmployeeType type = emp->getType();
+
+    // Nothing may keep pointing at the technician once it is gone
+    if (type == EmployeeType::Technician) {
+        for (int req_id : technicians[position.typed_index]->releaseActiveRequests()) {
+            RepairRequest* request = findRepairRequestById(req_id);
+            if (!request || request->getStatus() != Status::InProgress) continue;
+            request->setTechnicianId(0);
+            setRequestStatus(*request, Status::Pending);
+        }
+    }
+
+    if (auto key = CNPValidator::packKey(emp->getCNP())) employees_by_cnp.erase(*key);
+    stats.employees_by_type[static_cast<std::size_t>(type)]--;
+    stats.total_employees--;
+    if (salaries_valid && salaries_computed_on == clock.today()) {
+        total_salaries -= emp->getSalary();
+    }
+
+    // Swap and pop, first in the unified view, then in the owning container
+    employee_slots.erase(slot);
+    if (position.index + 1 != employees.size()) {
+        employees[position.index] = employees.back();
+        employee_slots[employees[position.index]->getId()].index = position.index;
+    }
+    employees.pop_back();
+
+    switch (type) {
+        case EmployeeType::Technician:
+            eraseTyped(technicians, position.typed_index);
+            skill_coverage.clear();
+            for (const auto& tech : technicians) skill_coverage.addAll(tech->getSkillSet());
+            break;
+        case EmployeeType::Receptionist: eraseTyped(receptionists, position.typed_index); break;
+        case EmployeeType::Supervisor: eraseTyped(supervisors, position.typed_index); break;
+    }
+
+    touch();
+    return true;
+}
+
+template <typename T>
+void ServiceManager::eraseTyped(std::vector<std::unique_ptr<T>>& container, std::size_t typed_index) {
+    if (typed_index + 1 != container.size()) {
+        container[typed_index] = std::move(container.back());
+        employee_slots[container[typed_index]->getId()].typed_index = typed_index;
+    }
+    container.pop_back();
+}
+
+void ServiceManager::clear() {
+    // Requests first: nothing may point at a destroyed request
+    requests_by_id.clear();
+    for (auto& ids : request_ids_by_status) ids.clear();
+    pending_groups.clear();
+    in_progress_by_duration.clear();
+    repair_requests.clear();
+    employee_slots.clear();
+    employees_by_cnp.clear();
+    employees.clear();
+    technicians.clear();
+    receptionists.clear();
+    supervisors.clear();
+
+    pending_by_skill.clear();
+    skill_ready.clear();
+    ready_skills.clear();
+    skill_full_in_pass.clear();
+    skill_coverage.clear();
+    scheduling_policy->reset();
+    stats = ServiceStats{};
+    salaries_valid = false;
+    touch();
+}
+
+Employee* ServiceManager::findEmployeeById(int id){
+    PROFILE_COUNT(EmployeeLookups);
+    auto it = employee_slots.find(id);
+    return it != employee_slots.end() ? employees[it->second.index] : nullptr;
+}
+
+Technician* ServiceManager::findTechnicianById(int id){
+    PROFILE_COUNT(EmployeeLookups);
+    auto it = employee_slots.find(id);
+    if (it == employee_slots.end() || employees[it->second.index]->getType() != EmployeeType::Technician) {
+        return nullptr;
+    }
+    return technicians[it->second.typed_index].get();
+}
+
+Employee* ServiceManager::findEmployeeByCNP(std::string_view CNP){
+    PROFILE_COUNT(EmployeeLookups);
+    std::optional<std::uint64_t> key = CNPValidator::packKey(CNP);
+    if (!key) return nullptr;
+
+    auto it = employees_by_cnp.find(*key);
+    return it != employees_by_cnp.end() ? it->second : nullptr;
+}
+
 std::vector<int> ServiceManager::filter(
         Status status,
         std::chrono::system_clock::time_point start,
@@ -51,13 +417,9 @@ std::vector<int> ServiceManager::filter(
 {
     std::vector<int> filtered_ids;
 
-    // Iterate through all stored repair requests
-    for (const auto& request : repair_requests) {
-        
-        // Filter by Status
-        if (request->getStatus() != status) {
-            continue;
-        }
+    // Only requests that already have the wanted status are visited
+    for (int id : request_ids_by_status[static_cast<std::size_t>(status)]) {
+        const RepairRequest* request = findRepairRequestById(id);
 
         // Filter by Technician ID
         // If technician_id is 0, we treat it as "any technician"
@@ -88,26 +450,69 @@ bool ServiceManager::canRepair(int repair_request_id) const {
     const RepairRequest* request = findRepairRequestById(repair_request_id);
     if (!request) return false;
 
-    const Appliance& appliance = request->getAppliance();
+    // At least one technician can fix it
+    return skill_coverage.contains(request->getAppliance());
+}
+
+std::vector<const Technician*> ServiceManager::getTechniciansCoveringAll(const SkillSet& required) const {
+    std::vector<const Technician*> result;
+    for (const auto& tech : technicians) {
+        if (tech->getSkillSet().containsAll(required)) {
+            result.push_back(tech.get());
+        }
+    }
+    return result;
+}
 
-    for (const auto& emp : employees) {
-        // Check if the employee is a Technician
-        Technician* tech = dynamic_cast<Technician*>(emp.get());
-        if (tech && tech->canRepair(appliance)) {
-            return true; // Found at least one technician who can fix it
+std::vector<const Technician*> ServiceManager::getTechniciansCoveringAny(const SkillSet& required) const {
+    std::vector<const Technician*> result;
+    for (const auto& tech : technicians) {
+        if (tech->getSkillSet().intersects(required)) {
+            result.push_back(tech.get());
         }
     }
-    return false;
+    return result;
+}
+
+const std::vector<int>& ServiceManager::snapshotIds(Status status) {
+    // The status sets change while the caller walks the ids, hence the copy
+    const auto& ids = request_ids_by_status[static_cast<std::size_t>(status)];
+    tick_ids.assign(ids.begin(), ids.end());
+    return tick_ids;
 }
 
+void ServiceManager::setSchedulingPolicy(std::unique_ptr<SchedulingPolicy> policy) {
+    scheduling_policy = std::move(policy);
+
+    // Re-sort the pending buckets by the new policy's keys
+    for (auto& bucket : pending_by_skill) {
+        std::set<std::pair<long long, int>> resorted;
+        for (const auto& [key, id] : bucket) {
+            resorted.insert({scheduling_policy->skillKey(*findRepairRequestById(id)), id});
+        }
+        bucket = std::move(resorted);
+    }
+}
+
+SchedulingPolicy& ServiceManager::getSchedulingPolicy() { return *scheduling_policy; }
+
+void ServiceManager::setAssignmentMode(AssignmentMode mode, std::chrono::microseconds budget) {
+    assignment_mode = mode;
+    batch_budget = budget;
+}
+
+AssignmentMode ServiceManager::getAssignmentMode() const { return assignment_mode; }
+std::chrono::microseconds ServiceManager::getBatchBudget() const { return batch_budget; }
+
 void ServiceManager::checkReceived(){
-    
-    std::vector<int> recieved_repair_request_ids = filter(Status::Received);
-    for (auto recieved_repair_request_id : recieved_repair_request_ids){
+    PROFILE_SCOPE(CheckReceived);
+
+    for (auto recieved_repair_request_id : snapshotIds(Status::Received)){
+        RepairRequest* request = findRepairRequestById(recieved_repair_request_id);
         if (canRepair(recieved_repair_request_id)){
-            findRepairRequestById(recieved_repair_request_id)->setStatus(Status::Pending);
+            setRequestStatus(*request, Status::Pending);
         } else {
-            findRepairRequestById(recieved_repair_request_id)->setStatus(Status::Rejected);
+            setRequestStatus(*request, Status::Rejected);
         }
     }
 }
@@ -116,68 +521,134 @@ void ServiceManager::autoAssignRequests() {
 
     checkReceived(); 
 
-    //Get all requests that are ready to be assigned
-    std::vector<int> pending_ids = filter(Status::Pending);
+    // Timed separately from checkReceived so the phases don't overlap
+    PROFILE_SCOPE(AutoAssign);
+
+    //Get the pending requests of every ready skill bucket; the rest are
+    //blocked and would not find a technician anyway. Buckets are sorted the
+    //way the policy orders them, and no more requests than there are free
+    //slots for a skill can be placed, so only that many are taken.
+    tick_requests.clear();
+    for (std::size_t skill : ready_skills) {
+        skill_ready[skill] = false;
+        const auto& bucket = pending_by_skill[skill];
+        std::size_t limit = std::min(bucket.size(), freeSlotsFor(skill));
+        auto it = bucket.begin();
+        for (std::size_t n = 0; n < limit; n++, ++it) {
+            tick_requests.push_back(findRepairRequestById(it->second));
+        }
+    }
+    ready_skills.clear();
+    if (tick_requests.empty()) return;
+
+    // Policies expect id order
+    std::sort(tick_requests.begin(), tick_requests.end(),
+              [](const RepairRequest* a, const RepairRequest* b) { return a->getId() < b->getId(); });
+    scheduling_policy->order(tick_requests);
+    assign_pass++;
+    if (skill_full_in_pass.size() < pending_by_skill.size()) skill_full_in_pass.resize(pending_by_skill.size(), 0);
+
+    if (assignment_mode == AssignmentMode::Batch) {
+        auto deadline = std::chrono::steady_clock::now() + batch_budget;
+        const std::vector<int>& matches =
+            batch_matcher.solve(tick_requests, technicians, MAX_ACTIVE_REQUESTS, deadline);
 
-    for (int req_id : pending_ids) {
-        RepairRequest* request = findRepairRequestById(req_id);
-        if (!request) continue;
+        // Applied in policy order so stateful policies see the same sequence
+        for (std::size_t i = 0; i < tick_requests.size(); i++) {
+            if (matches[i] >= 0) {
+                assignRequest(*tick_requests[i], *technicians[matches[i]]);
+            }
+        }
+        if (!batch_matcher.timedOut()) return;
+        // The requests the matcher did not reach fall through to the greedy pass
+        stats.batch_timeouts++;
+    }
 
+    for (RepairRequest* request : tick_requests) {
+        if (request->getStatus() != Status::Pending) continue; // Taken by the batch pass
         const Appliance& appliance = request->getAppliance();
 
+        // Another request needing this skill already found every technician busy
+        std::size_t skill = SkillSet::bitIndex(appliance);
+        if (skill_full_in_pass[skill] == assign_pass) continue;
+
         Technician* best_tech = nullptr;
-        int min_load = 4; // Since the limit is 3, 4 acts as "infinity"
+        int min_load = MAX_ACTIVE_REQUESTS + 1; // Acts as "infinity"
 
         // Search for the best technician for this specific appliance
-        for (auto& emp : employees) {
-            Technician* tech = dynamic_cast<Technician*>(emp.get());
-            
-            // Check if they are a technician and have the matching skill
-            if (tech && tech->canRepair(appliance)) {
+        for (auto& tech : technicians) {
+            // Check if they have the matching skill
+            if (tech->canRepair(appliance)) {
                 int current_load = tech->getActiveRequestsCount();
                 
-                // Only consider if they have space (< 3) 
+                // Only consider if they have space 
                 // and if they have fewer requests than our previous best candidate
-                if (current_load < 3 && current_load < min_load) {
+                if (current_load < MAX_ACTIVE_REQUESTS && current_load < min_load) {
                     min_load = current_load;
-                    best_tech = tech;
+                    best_tech = tech.get();
                 }
             }
         }
 
         // If a candidate was found, perform the assignment
         if (best_tech) {
-            request->setStatus(Status::InProgress);
-            request->setTechnicianId(best_tech->getId()); 
-            best_tech->addActiveRequest(req_id); 
-            
-            std::cout << "Assigned Request #" << req_id << " to Tech " 
-                      << best_tech->getId() << " (Current Load: " << min_load + 1 << ")\n";
+            assignRequest(*request, *best_tech);
+        } else {
+            skill_full_in_pass[skill] = assign_pass;
         }
     }
 }
 
+void ServiceManager::assignRequest(RepairRequest& request, Technician& technician) {
+    setRequestStatus(request, Status::InProgress);
+    request.setTechnicianId(technician.getId()); 
+    technician.addActiveRequest(request.getId()); 
+    scheduling_policy->onAssigned(request);
+    stats.assignments++;
+    PROFILE_COUNT(Assignments);
+    
+    std::cout << "Assigned Request #" << request.getId() << " to Tech " 
+              << technician.getId() << " (Current Load: " << technician.getActiveRequestsCount() << ")\n";
+}
+
 void ServiceManager::tick() {
+    PROFILE_SCOPE(Tick);
+
     // Try to assign any Received/Pending requests to available technicians
     autoAssignRequests();
 
     // Iterate through all employees and "tick" the technicians
-    for (auto& emp : employees) {
-        // Since employees are stored as unique_ptr<Employee>, 
-        // we use dynamic_cast to identify Technicians
-        Technician* tech = dynamic_cast<Technician*>(emp.get());
-        
-        if (tech) {
+    {
+        PROFILE_SCOPE(TechnicianTick);
+        for (auto& tech : technicians) {
             // This calls Technician::tick(), which decrements remaining time 
             // for their active requests
             tech->tick();
         }
     }
+
+    clock.advance();
+    touch();
 }
 
-const std::vector<std::unique_ptr<Employee>>& ServiceManager::getEmployees() const { return employees; }
+std::vector<int> ServiceManager::getLongestRepairs(std::size_t n) const {
+    std::vector<int> request_ids;
+    for (auto it = in_progress_by_duration.begin();
+         it != in_progress_by_duration.end() && request_ids.size() < n; ++it) {
+        request_ids.push_back(it->second);
+    }
+    return request_ids;
+}
+
+const std::vector<Employee*>& ServiceManager::getEmployees() const { return employees; }
+const std::vector<std::unique_ptr<Technician>>& ServiceManager::getTechnicians() const { return technicians; }
+const std::vector<std::unique_ptr<Receptionist>>& ServiceManager::getReceptionists() const { return receptionists; }
+const std::vector<std::unique_ptr<Supervisor>>& ServiceManager::getSupervisors() const { return supervisors; }
 const std::vector<std::unique_ptr<RepairRequest>>& ServiceManager::getRepairRequests() const { return repair_requests; }
 
+Clock& ServiceManager::getClock() { return clock; }
+const Clock& ServiceManager::getClock() const { return clock; }
+
 // ============================================================================
 // CSV HELPER FUNCTIONS
 // ============================================================================
@@ -223,6 +694,15 @@ std::vector<std::string> ServiceManager::parseCSVLine(const std::string& line) {
     return fields;
 }
 
+std::string ServiceManager::employeeTypeToString(EmployeeType type) const {
+    switch (type) {
+        case EmployeeType::Technician: return "Technician";
+        case EmployeeType::Receptionist: return "Receptionist";
+        case EmployeeType::Supervisor: return "Supervisor";
+    }
+    return "Unknown";
+}
+
 // ============================================================================
 // SAVE EMPLOYEES TO CSV
 // ============================================================================
@@ -282,7 +762,7 @@ bool ServiceManager::saveEmployeesToCSV(const std::string& filename) {
         
         // Type-specific data
         if (type == EmployeeType::Technician) {
-            Technician* tech = dynamic_cast<Technician*>(emp.get());
+            const Technician* tech = static_cast<const Technician*>(emp);
             const std::vector<Skill>& skills = tech->getSkills();
             std::string skills_str;
             for (size_t i = 0; i < skills.size(); ++i) {
@@ -295,8 +775,8 @@ bool ServiceManager::saveEmployeesToCSV(const std::string& filename) {
         }
         
         if (type == EmployeeType::Receptionist) {
-            Receptionist* rec = dynamic_cast<Receptionist*>(emp.get());
-            std::vector<int> requests = rec->getReceivedRepairRequests();
+            Receptionist* rec = static_cast<Receptionist*>(emp);
+            const std::vector<int>& requests = rec->getReceivedRepairRequests();
             std::string requests_str;
             for (size_t i = 0; i < requests.size(); ++i) {
                 if (i > 0) requests_str += ";";
@@ -389,7 +869,7 @@ bool ServiceManager::saveRepairRequestsToCSV(const std::string& filename) {
 // LOAD EMPLOYEES FROM CSV
 // ============================================================================
 
-bool ServiceManager::loadEmployeesFromCSV(const std::string& filename) {
+bool ServiceManager::loadEmployeesFromCSV(const std::string& filename, std::size_t& skipped_rows) {
     std::ifstream file(filename);
     if (!file.is_open()) {
         std::cerr << "Error: Could not open " << filename << " for reading.\n";
@@ -400,6 +880,7 @@ bool ServiceManager::loadEmployeesFromCSV(const std::string& filename) {
     std::getline(file, line); // Skip header
     
     int line_num = 1;
+    int bad_checksums = 0;
     while (std::getline(file, line)) {
         ++line_num;
         if (line.empty()) continue;
@@ -409,6 +890,7 @@ bool ServiceManager::loadEmployeesFromCSV(const std::string& filename) {
             
             if (fields.size() < 16) {
                 std::cerr << "Error: Invalid employee data on line " << line_num << "\n";
+                skipped_rows++;
                 continue;
             }
             
@@ -418,6 +900,29 @@ bool ServiceManager::loadEmployeesFromCSV(const std::string& filename) {
             std::string last_name = fields[3];
             std::string cnp = fields[4];
             
+            // Only CNPs that are not 13 digits are rejected, the manager could
+            // not index them. Anything else only warns, since older employee
+            // files were never validated.
+            CNPInfo cnp_info = CNPValidator::validate(cnp);
+            if (cnp_info.error == CNPError::Length || cnp_info.error == CNPError::NonDigit) {
+                std::cerr << "Error: " << CNPValidator::errorMessage(cnp_info.error)
+                          << " on line " << line_num << "\n";
+                skipped_rows++;
+                continue;
+            }
+            if (Employee* existing = findEmployeeByCNP(cnp)) {
+                std::cerr << "Error: Duplicate CNP on line " << line_num
+                          << " (already used by employee " << existing->getId() << ")\n";
+                skipped_rows++;
+                continue;
+            }
+            if (cnp_info.error == CNPError::Checksum) {
+                bad_checksums++;
+            } else if (!cnp_info.isValid()) {
+                std::cerr << "Warning: " << CNPValidator::errorMessage(cnp_info.error)
+                          << " on line " << line_num << "\n";
+            }
+            
             // Parse date (format: YYYY-MM-DD)
             std::string date_str = fields[5];
             int year, month, day;
@@ -496,15 +1001,25 @@ bool ServiceManager::loadEmployeesFromCSV(const std::string& filename) {
                 );
             }
             
-            if (emp) {
-                addEmployee(std::move(emp));
+            if (!emp) {
+                std::cerr << "Error: Unknown employee type on line " << line_num << "\n";
+                skipped_rows++;
+            } else if (!addEmployee(std::move(emp))) {
+                std::cerr << "Error: Employee id " << id << " on line " << line_num << " is already in use\n";
+                skipped_rows++;
             }
             
         } catch (const std::exception& e) {
             std::cerr << "Error parsing employee on line " << line_num << ": " << e.what() << "\n";
+            skipped_rows++;
         }
     }
     
+    if (bad_checksums > 0) {
+        std::cerr << "Warning: " << bad_checksums << " employee(s) in " << filename
+                  << " have a CNP with an invalid checksum\n";
+    }
+    
     file.close();
     return true;
 }
@@ -513,7 +1028,8 @@ bool ServiceManager::loadEmployeesFromCSV(const std::string& filename) {
 // LOAD REPAIR REQUESTS FROM CSV
 // ============================================================================
 
-bool ServiceManager::loadRepairRequestsFromCSV(RepairRequestFactory& requestFactory, const std::string& filename) {
+bool ServiceManager::loadRepairRequestsFromCSV(RepairRequestFactory& requestFactory, const std::string& filename,
+                                               std::size_t& skipped_rows) {
     std::ifstream file(filename);
     if (!file.is_open()) {
         std::cerr << "Error: Could not open " << filename << " for reading.\n";
@@ -533,6 +1049,7 @@ bool ServiceManager::loadRepairRequestsFromCSV(RepairRequestFactory& requestFact
             
             if (fields.size() < 18) {
                 std::cerr << "Error: Invalid repair request data on line " << line_num << "\n";
+                skipped_rows++;
                 continue;
             }
             
@@ -605,6 +1122,7 @@ bool ServiceManager::loadRepairRequestsFromCSV(RepairRequestFactory& requestFact
             
         } catch (const std::exception& e) {
             std::cerr << "Error parsing repair request on line " << line_num << ": " << e.what() << "\n";
+            skipped_rows++;
         }
     }
     
@@ -632,15 +1150,311 @@ bool ServiceManager::saveToCSV(const std::string& employees_file,
 bool ServiceManager::loadFromCSV(RepairRequestFactory& requestFactory,
                                   const std::string& employees_file, 
                                   const std::string& requests_file) {
-    bool emp_success = loadEmployeesFromCSV(employees_file);
-    bool req_success = loadRepairRequestsFromCSV(requestFactory, requests_file);
+    std::size_t skipped_rows = 0;
+    bool emp_success = loadEmployeesFromCSV(employees_file, skipped_rows);
+    bool req_success = loadRepairRequestsFromCSV(requestFactory, requests_file, skipped_rows);
     
-    if (emp_success && req_success) {
-        std::cout << "Data successfully loaded from " << employees_file 
-                  << " and " << requests_file << "\n";
-        return true;
+    if (!emp_success || !req_success) {
+        return false;
+    }
+    // Whatever could be read stays loaded, but it is not reported as a success
+    if (skipped_rows > 0) {
+        std::cerr << "Data loaded from " << employees_file << " and " << requests_file
+                  << " with " << skipped_rows << " row(s) skipped\n";
+        return false;
+    }
+    std::cout << "Data successfully loaded from " << employees_file 
+              << " and " << requests_file << "\n";
+    return true;
+}
+
+// ============================================================================
+// JSONL IMPORT
+// ============================================================================
+
+namespace {
+    // One intake record. Only the appliance fields, complexity and the
+    // receptionist are required (plus "unit", "cm" or "inch", for a TV); a
+    // record carrying an "id" is replayed as history, with the remaining
+    // fields defaulting like a fresh request. A "technician_id" must name an
+    // existing technician.
+    struct IntakeRecord {
+        std::string_view type, brand, model, unit, status;
+        bool brand_escaped = false, model_escaped = false;
+        long long year = 0, catalog_price = 0, complexity = 0, receptionist_id = 0;
+        long long id = 0, timestamp = 0, repair_duration = -1, remaining_time = -1;
+        long long price = -1, technician_id = 0;
+        double diagonal = 0.0, capacity = 0.0;
+        bool has_freezer = false, has_id = false, has_timestamp = false;
+    };
+
+    bool fitsInt(long long value) {
+        return value >= std::numeric_limits<int>::min() && value <= std::numeric_limits<int>::max();
+    }
+
+    const char* parseIntakeRecord(std::string_view line, IntakeRecord& rec) {
+        JsonLineScanner scanner(line);
+        JsonLineScanner::Field field;
+        bool ok = true;
+
+        while (ok && scanner.next(field)) {
+            const std::string_view key = field.key;
+            if (key == "type") rec.type = field.value;
+            else if (key == "brand") { rec.brand = field.value; rec.brand_escaped = field.escaped; }
+            else if (key == "model") { rec.model = field.value; rec.model_escaped = field.escaped; }
+            else if (key == "year") ok = JsonLineScanner::toInt(field, rec.year);
+            else if (key == "catalog_price") ok = JsonLineScanner::toInt(field, rec.catalog_price);
+            else if (key == "complexity") ok = JsonLineScanner::toInt(field, rec.complexity);
+            else if (key == "receptionist_id") ok = JsonLineScanner::toInt(field, rec.receptionist_id);
+            else if (key == "has_freezer") ok = JsonLineScanner::toBool(field, rec.has_freezer);
+            else if (key == "diagonal") ok = JsonLineScanner::toDouble(field, rec.diagonal);
+            else if (key == "unit") rec.unit = field.value;
+            else if (key == "capacity") ok = JsonLineScanner::toDouble(field, rec.capacity);
+            else if (key == "id") ok = rec.has_id = JsonLineScanner::toInt(field, rec.id);
+            else if (key == "timestamp") ok = rec.has_timestamp = JsonLineScanner::toInt(field, rec.timestamp);
+            else if (key == "repair_duration") ok = JsonLineScanner::toInt(field, rec.repair_duration);
+            else if (key == "remaining_time") ok = JsonLineScanner::toInt(field, rec.remaining_time);
+            else if (key == "price") ok = JsonLineScanner::toInt(field, rec.price);
+            else if (key == "status") rec.status = field.value;
+            else if (key == "technician_id") ok = JsonLineScanner::toInt(field, rec.technician_id);
+            // Unknown keys are ignored so newer producers can add fields
+        }
+
+        if (!ok) return "bad value for field";
+        if (scanner.failed()) return "malformed JSON";
+
+        // Everything but the timestamp ends up in an int; the timestamp in
+        // seconds must still fit in a system_clock time point
+        for (long long value : {rec.year, rec.catalog_price, rec.complexity, rec.receptionist_id, rec.id,
+                                rec.repair_duration, rec.remaining_time, rec.price, rec.technician_id}) {
+            if (!fitsInt(value)) return "value out of range";
+        }
+        constexpr long long MAX_TIMESTAMP = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::duration::max()).count();
+        if (rec.timestamp > MAX_TIMESTAMP || rec.timestamp < -MAX_TIMESTAMP) return "timestamp out of range";
+
+        if (rec.type.empty() || rec.brand.empty() || rec.model.empty()) return "missing appliance type, brand or model";
+        if (rec.complexity < 1 || rec.complexity > 5) return "complexity must be between 1 and 5";
+        if (rec.receptionist_id <= 0) return "missing receptionist_id";
+        return nullptr;
+    }
+
+    // Case-insensitive like stringToApplianceType, without building a string
+    std::optional<ApplianceType> parseApplianceType(std::string_view name) {
+        auto is = [name](std::string_view lower) {
+            return std::equal(name.begin(), name.end(), lower.begin(), lower.end(), [](char a, char b) {
+                return std::tolower(static_cast<unsigned char>(a)) == b;
+            });
+        };
+        if (is("fridge")) return ApplianceType::Fridge;
+        if (is("tv")) return ApplianceType::TV;
+        if (is("washingmachine")) return ApplianceType::WashingMachine;
+        return std::nullopt;
+    }
+
+    Status parseStatus(std::string_view status) {
+        if (status == "Pending") return Status::Pending;
+        if (status == "InProgress") return Status::InProgress;
+        if (status == "Completed") return Status::Completed;
+        if (status == "Rejected") return Status::Rejected;
+        return Status::Received;
     }
-    return false;
+}
+
+bool ServiceManager::importRepairRequestsFromJSONL(RepairRequestFactory& requestFactory, const std::string& filename) {
+    std::FILE* file = std::fopen(filename.c_str(), "rb");
+    if (!file) {
+        std::cerr << "Error: Could not open " << filename << " for reading.\n";
+        return false;
+    }
+
+    // Requests are handed to the manager in batches so the indexes and the
+    // change listener are touched once per batch rather than once per line
+    constexpr std::size_t BATCH_SIZE = 4096;
+    constexpr int MAX_REPORTED_ERRORS = 20;
+
+    std::vector<std::unique_ptr<RepairRequest>> batch;
+    batch.reserve(BATCH_SIZE);
+    std::set<int> batch_ids;
+
+    std::vector<char> buffer(1 << 20);
+    std::size_t filled = 0;
+    std::size_t line_num = 0, imported = 0, errors = 0;
+    bool eof = false;
+
+    auto reportError = [&](const std::string& error) {
+        if (++errors <= MAX_REPORTED_ERRORS) {
+            std::cerr << "Error importing repair request on line " << line_num << ": " << error << "\n";
+        }
+    };
+
+    auto importLine = [&](std::string_view line) {
+        ++line_num;
+        while (!line.empty() && (line.back() == '\r' || line.back() == ' ')) line.remove_suffix(1);
+        if (line.empty()) return;
+
+        IntakeRecord rec;
+        std::string error;
+        if (const char* parse_error = parseIntakeRecord(line, rec)) error = parse_error;
+
+        if (error.empty() && rec.has_id && (requests_by_id.count(rec.id) || batch_ids.count(rec.id))) {
+            error = "duplicate request id";
+        }
+        if (error.empty()) {
+            // Durations and prices left out are derived from the appliance's
+            // age, and have to fit in an int as well
+            long long age = static_cast<long long>(int(clock.today().year())) - rec.year;
+            bool derive_duration = !rec.has_id || rec.repair_duration < 0;
+            bool derive_price = !rec.has_id || rec.price < 0;
+            if (!fitsInt(age) || (derive_duration && !fitsInt(age * rec.complexity)) ||
+                (derive_price && !fitsInt(age * rec.catalog_price))) {
+                error = "value out of range";
+            }
+        }
+        if (error.empty()) {
+            Employee* receptionist = findEmployeeById(static_cast<int>(rec.receptionist_id));
+            if (!receptionist || receptionist->getType() != EmployeeType::Receptionist) {
+                error = "no receptionist with id " + std::to_string(rec.receptionist_id);
+            }
+        }
+
+        try {
+            if (error.empty()) {
+                std::string brand = rec.brand_escaped ? JsonLineScanner::unescape(rec.brand) : std::string(rec.brand);
+                std::string model = rec.model_escaped ? JsonLineScanner::unescape(rec.model) : std::string(rec.model);
+                int year = static_cast<int>(rec.year);
+                int catalog_price = static_cast<int>(rec.catalog_price);
+
+                std::optional<ApplianceType> type = parseApplianceType(rec.type);
+                if (!type) return reportError("Unknown appliance type: " + std::string(rec.type));
+
+                std::unique_ptr<Appliance> appliance;
+                switch (*type) {
+                    case ApplianceType::Fridge:
+                        appliance = ApplianceFactory::createApplianceFridge(
+                            brand, model, year, catalog_price, rec.has_freezer);
+                        break;
+                    case ApplianceType::TV:
+                        if (rec.unit != "cm" && rec.unit != "inch") {
+                            error = "TV needs a unit of \"cm\" or \"inch\"";
+                            break;
+                        }
+                        appliance = ApplianceFactory::createApplianceTV(
+                            brand, model, year, catalog_price, rec.diagonal,
+                            rec.unit == "cm" ? DiagonalUnit::Centimeters : DiagonalUnit::Inches);
+                        break;
+                    case ApplianceType::WashingMachine:
+                        appliance = ApplianceFactory::createApplianceWashingMachine(
+                            brand, model, year, catalog_price, rec.capacity);
+                        break;
+                }
+
+                if (!error.empty()) return reportError(error);
+
+                int complexity = static_cast<int>(rec.complexity);
+                int receptionist_id = static_cast<int>(rec.receptionist_id);
+                std::unique_ptr<RepairRequest> request;
+
+                if (rec.has_id) {
+                    // Historical record: same defaults as a fresh request
+                    int age = appliance->getAge();
+                    int duration = rec.repair_duration >= 0 ? static_cast<int>(rec.repair_duration) : age * complexity;
+                    int remaining = rec.remaining_time >= 0 ? static_cast<int>(rec.remaining_time) : duration;
+                    int price = rec.price >= 0 ? static_cast<int>(rec.price) : age * catalog_price;
+                    auto timestamp = rec.has_timestamp
+                        ? std::chrono::system_clock::from_time_t(static_cast<std::time_t>(rec.timestamp))
+                        : clock.now();
+
+                    Status status = parseStatus(rec.status);
+                    Technician* technician = nullptr;
+                    if (rec.technician_id != 0) {
+                        technician = findTechnicianById(static_cast<int>(rec.technician_id));
+                        if (!technician) {
+                            return reportError("no technician with id " + std::to_string(rec.technician_id));
+                        }
+                    }
+                    // Only in-progress and completed work has a technician. In-progress
+                    // work must also be in its technician's active list to be ticked;
+                    // without a free slot there it goes back to the queue.
+                    if (status == Status::InProgress &&
+                        (!technician || technician->getActiveRequestsCount() >= MAX_ACTIVE_REQUESTS)) {
+                        status = Status::Pending;
+                    }
+                    if (status != Status::InProgress && status != Status::Completed) technician = nullptr;
+
+                    request = requestFactory.createRepairRequestFromCSV(
+                        static_cast<int>(rec.id), std::move(appliance), timestamp, complexity,
+                        duration, remaining, price, status,
+                        receptionist_id, technician ? technician->getId() : 0);
+                    if (status == Status::InProgress) technician->addActiveRequest(request->getId());
+                } else {
+                    int duration = appliance->getAge() * complexity;
+                    request = requestFactory.createRepairRequest(
+                        std::move(appliance), complexity, duration, receptionist_id);
+                    // The factory's counter may lag behind ids already in use
+                    int id = request->getId();
+                    if (requests_by_id.count(id) || batch_ids.count(id)) {
+                        return reportError("generated request id " + std::to_string(id) + " is already in use");
+                    }
+                }
+
+                batch_ids.insert(request->getId());
+                batch.push_back(std::move(request));
+            }
+        } catch (const std::invalid_argument& e) {
+            error = e.what();
+        }
+
+        if (!error.empty()) return reportError(error);
+
+        if (batch.size() >= BATCH_SIZE) {
+            imported += batch.size();
+            addRepairRequests(batch);
+            batch_ids.clear();
+        }
+    };
+
+    while (!eof) {
+        std::size_t count = std::fread(buffer.data() + filled, 1, buffer.size() - filled, file);
+        filled += count;
+        eof = (count == 0);
+
+        // Hand out every complete line; the tail waits for the next read
+        std::size_t start = 0;
+        while (true) {
+            const void* newline = std::memchr(buffer.data() + start, '\n', filled - start);
+            if (!newline) break;
+            std::size_t end = static_cast<const char*>(newline) - buffer.data();
+            importLine(std::string_view(buffer.data() + start, end - start));
+            start = end + 1;
+        }
+
+        if (eof && start < filled) {
+            importLine(std::string_view(buffer.data() + start, filled - start));
+            start = filled;
+        }
+
+        std::memmove(buffer.data(), buffer.data() + start, filled - start);
+        filled -= start;
+
+        // A single line longer than the buffer: grow it
+        if (filled == buffer.size()) {
+            buffer.resize(buffer.size() * 2);
+        }
+    }
+    std::fclose(file);
+
+    imported += batch.size();
+    if (!batch.empty()) {
+        addRepairRequests(batch);
+    }
+
+    if (errors > MAX_REPORTED_ERRORS) {
+        std::cerr << "... " << (errors - MAX_REPORTED_ERRORS) << " more errors not shown\n";
+    }
+    std::cout << "Imported " << imported << " repair requests from " << filename
+              << " (" << errors << " rejected lines)\n";
+    return true;
 }
 
 // Add these implementations to ServiceManager.cpp
@@ -653,7 +1467,13 @@ bool ServiceManager::loadFromCSV(RepairRequestFactory& requestFactory,
 // REPORT GENERATION METHODS
 // ============================================================================
 
-bool ServiceManager::generateTop3SalariesReport(const std::string& filename) {
+std::vector<const Employee*> ServiceManager::getTopSalaries(std::size_t k) const {
+    TopSalaries top(k, employees.size());
+    top.offerAll(employees);
+    return top.sorted();
+}
+
+bool ServiceManager::generateTopSalariesReport(const std::string& filename, std::size_t k) {
     std::ofstream file(filename);
     if (!file.is_open()) {
         std::cerr << "Error: Could not open " << filename << " for writing.\n";
@@ -663,44 +1483,17 @@ bool ServiceManager::generateTop3SalariesReport(const std::string& filename) {
     // Header
     file << "Rank,ID,First Name,Last Name,Type,Salary (RON)\n";
     
-    // Calculate salaries for all employees
-    std::vector<Employee*> employeeList;
-    for (const auto& emp : employees) {
-        const_cast<Employee*>(emp.get())->setSalary();
-        employeeList.push_back(emp.get());
-    }
-    
-    // Sort by salary (descending), then by last name, then by first name
-    std::sort(employeeList.begin(), employeeList.end(), 
-        [](const Employee* a, const Employee* b) {
-            if (a->getSalary() != b->getSalary()) {
-                return a->getSalary() > b->getSalary();
-            }
-            if (a->getLastName() != b->getLastName()) {
-                return a->getLastName() < b->getLastName();
-            }
-            return a->getFirstName() < b->getFirstName();
-        });
+    // Bounded selection by salary (descending), then by last name, then by first name
+    std::vector<const Employee*> employeeList = getTopSalaries(k);
     
-    // Write top 3
-    int count = std::min(3, static_cast<int>(employeeList.size()));
-    for (int i = 0; i < count; i++) {
+    for (size_t i = 0; i < employeeList.size(); i++) {
         const Employee* emp = employeeList[i];
         
-        // Determine employee type string
-        std::string typeStr;
-        switch (emp->getType()) {
-            case EmployeeType::Technician: typeStr = "Technician"; break;
-            case EmployeeType::Receptionist: typeStr = "Receptionist"; break;
-            case EmployeeType::Supervisor: typeStr = "Supervisor"; break;
-            default: typeStr = "Unknown"; break;
-        }
-        
         file << (i + 1) << ","
              << emp->getId() << ","
              << escapeCSV(emp->getFirstName()) << ","
              << escapeCSV(emp->getLastName()) << ","
-             << typeStr << ","
+             << employeeTypeToString(emp->getType()) << ","
              << emp->getSalary() << "\n";
     }
     
@@ -709,6 +1502,10 @@ bool ServiceManager::generateTop3SalariesReport(const std::string& filename) {
     return true;
 }
 
+bool ServiceManager::generateTop3SalariesReport(const std::string& filename) {
+    return generateTopSalariesReport(filename, 3);
+}
+
 bool ServiceManager::generateLongestRepairReport(const std::string& filename) {
     std::ofstream file(filename);
     if (!file.is_open()) {
@@ -716,24 +1513,18 @@ bool ServiceManager::generateLongestRepairReport(const std::string& filename) {
         return false;
     }
     
-    // Find the technician with the longest repair duration
+    // The longest in-progress repair sits at the front of the leaderboard
     Technician* longestTech = nullptr;
     int maxDuration = 0;
     int requestId = 0;
     
-    for (const auto& emp : employees) {
-        // Check if the employee is a Technician
-        Technician* tech = dynamic_cast<Technician*>(emp.get());
-        if (tech) {
-            const std::vector<int>& activeRequests = tech->getActiveRequests();
-            for (int reqId : activeRequests) {
-                RepairRequest* req = findRepairRequestById(reqId);
-                if (req && req->getRepairDuration() > maxDuration) {
-                    maxDuration = req->getRepairDuration();
-                    longestTech = tech;
-                    requestId = reqId;
-                }
-            }
+    if (!in_progress_by_duration.empty()) {
+        const auto& [duration, reqId] = *in_progress_by_duration.begin();
+        const RepairRequest* req = findRepairRequestById(reqId);
+        if (req) {
+            longestTech = findTechnicianById(req->getTechnicianId());
+            maxDuration = duration;
+            requestId = reqId;
         }
     }
     
@@ -776,68 +1567,21 @@ bool ServiceManager::generatePendingRequestsReport(const std::string& filename)
     // Header
     file << "Appliance Type,Brand,Model,Request IDs,Count\n";
     
-    // Collect pending requests grouped by type/brand/model
-    struct RequestInfo {
-        ApplianceType type;
-        std::string brand;
-        std::string model;
-        std::vector<int> requestIds;
-    };
-    
-    std::vector<RequestInfo> pendingRequests;
-    
-    for (const auto& req : repair_requests) {
-        if (req->getStatus() == Status::Pending) {
-            const Appliance& app = req->getAppliance();
-            
-            // Check if we already have this type/brand/model
-            bool found = false;
-            for (auto& info : pendingRequests) {
-                if (info.type == app.getType() && 
-                    info.brand == app.getBrand() && 
-                    info.model == app.getModel()) {
-                    info.requestIds.push_back(req->getId());
-                    found = true;
-                    break;
-                }
-            }
-            
-            if (!found) {
-                RequestInfo info;
-                info.type = app.getType();
-                info.brand = app.getBrand();
-                info.model = app.getModel();
-                info.requestIds.push_back(req->getId());
-                pendingRequests.push_back(info);
-            }
-        }
-    }
-    
-    // Sort alphabetically by type, then brand, then model
-    std::sort(pendingRequests.begin(), pendingRequests.end(),
-        [](const RequestInfo& a, const RequestInfo& b) {
-            std::string aType = applianceTypeToString(a.type);
-            std::string bType = applianceTypeToString(b.type);
-            
-            if (aType != bType) return aType < bType;
-            if (a.brand != b.brand) return a.brand < b.brand;
-            return a.model < b.model;
-        });
-    
-    // Write report
-    for (const auto& info : pendingRequests) {
-        file << applianceTypeToString(info.type) << ","
-             << escapeCSV(info.brand) << ","
-             << escapeCSV(info.model) << ",";
+    // Pending requests are already grouped and ordered by type, brand and model
+    for (const auto& [key, requestIds] : pending_groups) {
+        const auto& [type, brand, model] = key;
+        file << applianceTypeToString(type) << ","
+             << escapeCSV(brand) << ","
+             << escapeCSV(model) << ",";
         
         // Write request IDs (semicolon-separated)
         std::string idsStr;
-        for (size_t i = 0; i < info.requestIds.size(); i++) {
-            if (i > 0) idsStr += "; ";
-            idsStr += std::to_string(info.requestIds[i]);
+        for (int id : requestIds) {
+            if (!idsStr.empty()) idsStr += "; ";
+            idsStr += std::to_string(id);
         }
         file << "\"" << idsStr << "\","
-             << info.requestIds.size() << "\n";
+             << requestIds.size() << "\n";
     }
     
     file.close();
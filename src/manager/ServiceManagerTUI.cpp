@@ -6,6 +6,11 @@
 #include <sstream>
 #include <iomanip>
 #include <ctime>
+#include <limits>
+#include <algorithm>
+#include <poll.h>
+#include <unistd.h>
+#include <fcntl.h>
 
 ServiceManagerTUI::ServiceManagerTUI(ServiceManager& mgr, RepairRequestFactory& reqFactory)
     : manager(mgr), requestFactory(reqFactory), currentMenu(MenuState::Main), 
@@ -14,6 +19,7 @@ ServiceManagerTUI::ServiceManagerTUI(ServiceManager& mgr, RepairRequestFactory&
 ServiceManagerTUI::~ServiceManagerTUI() {
     if (running) {
         running = false;
+        scheduler.stop();
         if (tickThread.joinable()) {
             tickThread.join();
         }
@@ -40,6 +46,17 @@ void ServiceManagerTUI::start() {
     
     getmaxyx(stdscr, maxY, maxX);
     
+    // Wakeup pipe, signaled by the manager whenever its state changes
+    if (pipe(wakePipe) == 0) {
+        for (int fd : wakePipe) {
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        }
+        manager.setChangeListener([this]() {
+            char byte = 1;
+            [[maybe_unused]] ssize_t written = write(wakePipe[1], &byte, 1);
+        });
+    }
+    
     // Start tick thread
     tickThread = std::thread(&ServiceManagerTUI::tickLoop, this);
     
@@ -48,59 +65,163 @@ void ServiceManagerTUI::start() {
     
     // Cleanup
     running = false;
+    scheduler.stop();
     if (tickThread.joinable()) {
         tickThread.join();
     }
+    manager.setChangeListener(nullptr);
+    for (int& fd : wakePipe) {
+        if (fd >= 0) close(fd);
+        fd = -1;
+    }
     endwin();
 }
 
 void ServiceManagerTUI::tickLoop() {
     using namespace std::chrono;
-    auto nextRun = steady_clock::now();
     
-    while (running) {
-        nextRun += seconds(1);
+    // The scheduler paces the ticks and coalesces the ones we fall behind on
+    while (running && scheduler.waitForNextTick()) {
+        auto start = steady_clock::now();
         
         {
             std::lock_guard<std::mutex> lock(managerMutex);
             manager.tick();
         }
         
-        std::this_thread::sleep_until(nextRun);
+        scheduler.recordTick(steady_clock::now() - start);
     }
 }
 
+void ServiceManagerTUI::changeSpeed(int direction) {
+    // Presets from slowest to fastest, the last one being unthrottled
+    static const double speeds[] = {1.0, 10.0, TickScheduler::MAX_SPEED};
+    const int count = sizeof(speeds) / sizeof(speeds[0]);
+    
+    double current = scheduler.getSpeed();
+    int index = 0;
+    for (int i = 0; i < count; i++) {
+        if (speeds[i] == current) index = i;
+    }
+    
+    index = std::clamp(index + direction, 0, count - 1);
+    scheduler.setSpeed(speeds[index]);
+    headerValid = false;
+}
+
 void ServiceManagerTUI::mainUILoop() {
     while (running) {
+        // Arm before drawing: a change that lands while painting leaves a
+        // byte in the pipe and simply causes one more pass
+        manager.armChangeListener();
         drawUI();
-        handleInput();
-        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        waitForEvents();
+        
+        while (running && handleInput()) {
+        }
+    }
+}
+
+void ServiceManagerTUI::waitForEvents() {
+    // Sleep until a key is pressed, the manager signals a change, or the
+    // header clock needs its next second
+    using namespace std::chrono;
+    auto sinceEpoch = system_clock::now().time_since_epoch();
+    int untilNextSecond = 1000 - static_cast<int>(duration_cast<milliseconds>(sinceEpoch).count() % 1000);
+    
+    pollfd fds[2] = {
+        {STDIN_FILENO, POLLIN, 0},
+        {wakePipe[0], POLLIN, 0}
+    };
+    int count = wakePipe[0] >= 0 ? 2 : 1;
+    auto waitStart = steady_clock::now();
+    if (poll(fds, count, untilNextSecond) > 0 && count == 2 && (fds[1].revents & POLLIN)) {
+        char buffer[64];
+        while (read(wakePipe[0], buffer, sizeof(buffer)) > 0) {
+        }
+        
+        // When the simulation runs fast, repaint for data changes at most
+        // 20 times per second; keys still wake us immediately
+        auto elapsed = duration_cast<milliseconds>(steady_clock::now() - waitStart).count();
+        if (!(fds[0].revents & POLLIN) && elapsed < 50) {
+            poll(fds, 1, static_cast<int>(50 - elapsed));
+        }
     }
 }
 
 void ServiceManagerTUI::drawUI() {
-    clear();
-    drawHeader();
+    bool damaged = false;
+    
+    // The generation is atomic, so checking for changes doesn't need the lock
+    std::uint64_t generation = manager.getGeneration();
+    std::time_t second = std::time(nullptr);
+    
+    if (!headerValid || drawnHeaderSecond != second || drawnHeaderGeneration != generation) {
+        clearRegion(0, 3);
+        drawHeader();
+        drawnHeaderSecond = second;
+        drawnHeaderGeneration = generation;
+        headerValid = true;
+        damaged = true;
+    }
     
-    switch (currentMenu) {
-        case MenuState::Main:
-            drawMainMenu();
-            break;
-        case MenuState::EmployeeManagement:
-            drawEmployeeMenu();
-            break;
-        case MenuState::RequestManagement:
-            drawRequestMenu();
-            break;
-        case MenuState::ViewStatistics:
-            drawStatistics();
-            break;
-        default:
-            break;
+    // Only the overview, the statistics and the profiler pages show live data
+    bool showsLiveData = currentMenu == MenuState::Main || currentMenu == MenuState::ViewStatistics ||
+                         currentMenu == MenuState::ViewProfiler;
+    if (!contentValid || drawnMenu != currentMenu || drawnItem != selectedItem ||
+        (showsLiveData && drawnContentGeneration != generation)) {
+        clearContent();
+        
+        switch (currentMenu) {
+            case MenuState::Main:
+                drawMainMenu();
+                break;
+            case MenuState::EmployeeManagement:
+                drawEmployeeMenu();
+                break;
+            case MenuState::RequestManagement:
+                drawRequestMenu();
+                break;
+            case MenuState::ViewStatistics:
+                drawStatistics();
+                break;
+            case MenuState::ViewProfiler:
+                drawProfiler();
+                break;
+            default:
+                break;
+        }
+        
+        drawnMenu = currentMenu;
+        drawnItem = selectedItem;
+        drawnContentGeneration = generation;
+        contentValid = true;
+        damaged = true;
     }
     
-    drawFooter();
-    refresh();
+    if (!footerValid) {
+        clearRegion(maxY - 3, maxY);
+        drawFooter();
+        footerValid = true;
+        damaged = true;
+    }
+    
+    if (damaged) {
+        refresh();
+    }
+}
+
+void ServiceManagerTUI::invalidateUI() {
+    headerValid = false;
+    contentValid = false;
+    footerValid = false;
+}
+
+void ServiceManagerTUI::clearRegion(int fromRow, int toRow) {
+    for (int i = fromRow; i < toRow; i++) {
+        move(i, 0);
+        clrtoeol();
+    }
 }
 
 void ServiceManagerTUI::drawHeader() {
@@ -112,7 +233,11 @@ void ServiceManagerTUI::drawHeader() {
     attroff(COLOR_PAIR(5) | A_BOLD);
     
     // Current time
-    auto now = std::chrono::system_clock::now();
+    std::chrono::system_clock::time_point now;
+    {
+        std::lock_guard<std::mutex> lock(managerMutex);
+        now = manager.getClock().now();
+    }
     auto time = std::chrono::system_clock::to_time_t(now);
     std::string timeStr = std::ctime(&time);
     timeStr.pop_back(); // Remove newline
@@ -121,6 +246,19 @@ void ServiceManagerTUI::drawHeader() {
     mvprintw(1, 2, "Time: %s", timeStr.c_str());
     attroff(COLOR_PAIR(1));
     
+    // Simulation pace and tick cost
+    double speed = scheduler.getSpeed();
+    TickTimingStats timing = scheduler.getTimingStats();
+    std::string speedStr = speed == TickScheduler::MAX_SPEED ? "max" : std::to_string(static_cast<int>(speed)) + "x";
+    
+    attron(A_DIM);
+    mvprintw(1, std::max(40, maxX - 72), "Speed: %-4s (+/-) | Tick p50 %lldus p99 %lldus | Overruns %llu",
+             speedStr.c_str(),
+             static_cast<long long>(timing.latency.percentile(50).count() / 1000),
+             static_cast<long long>(timing.latency.percentile(99).count() / 1000),
+             static_cast<unsigned long long>(timing.overruns));
+    attroff(A_DIM);
+    
     mvhline(2, 0, ACS_HLINE, maxX);
 }
 
@@ -133,7 +271,6 @@ void ServiceManagerTUI::drawFooter() {
 }
 
 void ServiceManagerTUI::drawMainMenu() {
-    int centerX = maxX / 2;
     int menuWidth = 60;
     int startX = (maxX - menuWidth) / 2;
     
@@ -147,11 +284,12 @@ void ServiceManagerTUI::drawMainMenu() {
         "1. Employee Management",
         "2. Repair Request Management",
         "3. View Live Statistics",
-        "4. Exit Application"
+        "4. Hot-Path Profiler",
+        "5. Exit Application"
     };
     
     int optionStart = 8;
-    for (int i = 0; i < 4; i++) {
+    for (int i = 0; i < 5; i++) {
         if (i == selectedItem) {
             attron(A_REVERSE | A_BOLD | COLOR_PAIR(1));
             mvprintw(optionStart + i * 2, startX + 4, "-> %-50s", options[i]);
@@ -162,7 +300,11 @@ void ServiceManagerTUI::drawMainMenu() {
     }
     
     // Quick stats preview - larger box
-    std::lock_guard<std::mutex> lock(managerMutex);
+    ServiceStats stats;
+    {
+        std::lock_guard<std::mutex> lock(managerMutex);
+        stats = manager.getStats();
+    }
     
     int statsY = optionStart + 10;
     
@@ -172,40 +314,36 @@ void ServiceManagerTUI::drawMainMenu() {
     mvprintw(statsY + 2, startX, "+----------------------------------------------------------+");
     attroff(COLOR_PAIR(2) | A_BOLD);
     
-    auto received = manager.filter(Status::Received);
-    auto pending = manager.filter(Status::Pending);
-    auto in_progress = manager.filter(Status::InProgress);
-    auto completed = manager.filter(Status::Completed);
-    auto rejected = manager.filter(Status::Rejected);
+    const auto& counts = stats.requests_by_status;
     
     mvprintw(statsY + 3, startX, "|");
     mvprintw(statsY + 3, startX + 59, "|");
     attron(COLOR_PAIR(3));
-    mvprintw(statsY + 3, startX + 4, "Received Requests:        %5zu", received.size());
+    mvprintw(statsY + 3, startX + 4, "Received Requests:        %5zu", counts[static_cast<size_t>(Status::Received)]);
     attroff(COLOR_PAIR(3));
     
     mvprintw(statsY + 4, startX, "|");
     mvprintw(statsY + 4, startX + 59, "|");
     attron(COLOR_PAIR(3));
-    mvprintw(statsY + 4, startX + 4, "Pending Requests:         %5zu", pending.size());
+    mvprintw(statsY + 4, startX + 4, "Pending Requests:         %5zu", counts[static_cast<size_t>(Status::Pending)]);
     attroff(COLOR_PAIR(3));
     
     mvprintw(statsY + 5, startX, "|");
     mvprintw(statsY + 5, startX + 59, "|");
     attron(COLOR_PAIR(1));
-    mvprintw(statsY + 5, startX + 4, "In Progress:              %5zu", in_progress.size());
+    mvprintw(statsY + 5, startX + 4, "In Progress:              %5zu", counts[static_cast<size_t>(Status::InProgress)]);
     attroff(COLOR_PAIR(1));
     
     mvprintw(statsY + 6, startX, "|");
     mvprintw(statsY + 6, startX + 59, "|");
     attron(COLOR_PAIR(2));
-    mvprintw(statsY + 6, startX + 4, "Completed:                %5zu", completed.size());
+    mvprintw(statsY + 6, startX + 4, "Completed:                %5zu", counts[static_cast<size_t>(Status::Completed)]);
     attroff(COLOR_PAIR(2));
     
     mvprintw(statsY + 7, startX, "|");
     mvprintw(statsY + 7, startX + 59, "|");
     attron(COLOR_PAIR(4));
-    mvprintw(statsY + 7, startX + 4, "Rejected:                 %5zu", rejected.size());
+    mvprintw(statsY + 7, startX + 4, "Rejected:                 %5zu", counts[static_cast<size_t>(Status::Rejected)]);
     attroff(COLOR_PAIR(4));
     
     mvprintw(statsY + 8, startX, "+----------------------------------------------------------+");
@@ -272,8 +410,88 @@ void ServiceManagerTUI::drawRequestMenu() {
     }
 }
 
+void ServiceManagerTUI::drawProfiler() {
+    ProfileSnapshot snapshot;
+    {
+        std::lock_guard<std::mutex> lock(managerMutex);
+        snapshot = Profiler::getInstance().getSnapshot();
+    }
+    
+    int boxWidth = 70;
+    int startX = (maxX - boxWidth) / 2;
+    
+    attron(COLOR_PAIR(2) | A_BOLD);
+    mvprintw(4, startX, "+----------------------------------------------------------------------+");
+    mvprintw(5, startX, "|                      HOT-PATH PROFILER                               |");
+    mvprintw(6, startX, "+----------------------------------------------------------------------+");
+    attroff(COLOR_PAIR(2) | A_BOLD);
+    
+    int row = 9;
+    
+    if (!Profiler::isEnabled()) {
+        attron(COLOR_PAIR(4));
+        mvprintw(row, startX + 2, "Instrumentation is compiled out (rebuild with make PROFILE=1)");
+        attroff(COLOR_PAIR(4));
+        mvprintw(maxY - 5, startX + 2, "Press ESC to return to main menu");
+        return;
+    }
+    
+    attron(COLOR_PAIR(3) | A_BOLD);
+    mvprintw(row++, startX + 2, "%-16s %9s %11s %9s %9s %9s", "Phase", "Count", "Total ms", "p50 us", "p99 us", "Max us");
+    attroff(COLOR_PAIR(3) | A_BOLD);
+    row++;
+    
+    auto us = [](std::chrono::nanoseconds ns) { return static_cast<long long>(ns.count() / 1000); };
+    for (size_t i = 0; i < snapshot.phases.size(); i++) {
+        const LatencyHistogram& h = snapshot.phases[i];
+        mvprintw(row++, startX + 2, "%-16s %9llu %11.1f %9lld %9lld %9lld",
+                 Profiler::phaseName(static_cast<ProfilePhase>(i)),
+                 static_cast<unsigned long long>(h.getCount()), h.getTotal().count() / 1e6,
+                 us(h.percentile(50)), us(h.percentile(99)), us(h.getMax()));
+    }
+    
+    row += 2;
+    attron(COLOR_PAIR(3) | A_BOLD);
+    mvprintw(row++, startX + 2, "%-16s %9s %14s", "Counter", "Total", "Per tick");
+    attroff(COLOR_PAIR(3) | A_BOLD);
+    row++;
+    
+    std::uint64_t ticks = snapshot.phases[static_cast<size_t>(ProfilePhase::Tick)].getCount();
+    for (size_t i = 0; i < snapshot.counters.size(); i++) {
+        mvprintw(row++, startX + 2, "%-16s %9llu %14.1f",
+                 Profiler::counterName(static_cast<ProfileCounter>(i)),
+                 static_cast<unsigned long long>(snapshot.counters[i]),
+                 ticks ? static_cast<double>(snapshot.counters[i]) / ticks : 0.0);
+    }
+    
+    mvprintw(maxY - 5, startX + 2, "R Reset | D Dump to profile.csv | ESC Back");
+}
+
 void ServiceManagerTUI::drawStatistics() {
-    std::lock_guard<std::mutex> lock(managerMutex);
+    // Copy everything needed out of the manager first, so the lock is held
+    // only for the snapshot and not while painting
+    struct SalaryRow { std::string name; std::string type; int salary; };
+    struct RepairRow { int id; int technician; int duration; int remaining; };
+    
+    ServiceStats stats;
+    std::vector<SalaryRow> topSalaries;
+    std::vector<RepairRow> longestRepairs;
+    {
+        std::lock_guard<std::mutex> lock(managerMutex);
+        stats = manager.getStats();
+        
+        for (const Employee* emp : manager.getTopSalaries(5)) {
+            topSalaries.push_back({emp->getFirstName() + " " + emp->getLastName(),
+                                   employeeTypeToString(emp->getType()), emp->getSalary()});
+        }
+        for (int id : manager.getLongestRepairs(3)) {
+            const RepairRequest* req = manager.findRepairRequestById(id);
+            if (req) {
+                longestRepairs.push_back({req->getId(), req->getTechnicianId(),
+                                          req->getRepairDuration(), req->getRemainingTime()});
+            }
+        }
+    }
     
     int boxWidth = 70;
     int startX = (maxX - boxWidth) / 2;
@@ -284,11 +502,7 @@ void ServiceManagerTUI::drawStatistics() {
     mvprintw(6, startX, "+----------------------------------------------------------------------+");
     attroff(COLOR_PAIR(2) | A_BOLD);
     
-    auto received = manager.filter(Status::Received);
-    auto pending = manager.filter(Status::Pending);
-    auto in_progress = manager.filter(Status::InProgress);
-    auto completed = manager.filter(Status::Completed);
-    auto rejected = manager.filter(Status::Rejected);
+    const auto& counts = stats.requests_by_status;
     
     int row = 9;
     
@@ -297,28 +511,86 @@ void ServiceManagerTUI::drawStatistics() {
     attroff(COLOR_PAIR(3) | A_BOLD);
     row++;
     
-    mvprintw(row++, startX + 4, "Received:      %4zu requests", received.size());
-    mvprintw(row++, startX + 4, "Pending:       %4zu requests", pending.size());
-    mvprintw(row++, startX + 4, "In Progress:   %4zu requests", in_progress.size());
-    mvprintw(row++, startX + 4, "Completed:     %4zu requests", completed.size());
-    mvprintw(row++, startX + 4, "Rejected:      %4zu requests", rejected.size());
+    mvprintw(row++, startX + 4, "Received:      %4zu requests", counts[static_cast<size_t>(Status::Received)]);
+    mvprintw(row++, startX + 4, "Pending:       %4zu requests", counts[static_cast<size_t>(Status::Pending)]);
+    mvprintw(row++, startX + 4, "In Progress:   %4zu requests", counts[static_cast<size_t>(Status::InProgress)]);
+    mvprintw(row++, startX + 4, "Completed:     %4zu requests", counts[static_cast<size_t>(Status::Completed)]);
+    mvprintw(row++, startX + 4, "Rejected:      %4zu requests", counts[static_cast<size_t>(Status::Rejected)]);
     
     row += 2;
     attron(COLOR_PAIR(2) | A_BOLD);
-    size_t total = received.size() + pending.size() + in_progress.size() + 
-                   completed.size() + rejected.size();
-    mvprintw(row++, startX + 2, "Total Requests: %zu", total);
+    mvprintw(row++, startX + 2, "Total Requests: %zu", stats.total_requests);
     attroff(COLOR_PAIR(2) | A_BOLD);
+    mvprintw(row++, startX + 2, "Revenue (Completed): %lld RON | Remaining Work: %lld ticks",
+             stats.completed_revenue, stats.remaining_ticks);
+    
+    // Top earners, kept cheap by the bounded top-K selection
+    row += 2;
+    attron(COLOR_PAIR(3) | A_BOLD);
+    mvprintw(row++, startX + 2, "Top Salaries:");
+    attroff(COLOR_PAIR(3) | A_BOLD);
+    row++;
+    
+    for (size_t i = 0; i < topSalaries.size() && row < maxY - 6; i++) {
+        mvprintw(row++, startX + 4, "%zu. %-20s %-12s %6d RON", i + 1,
+                 topSalaries[i].name.c_str(), topSalaries[i].type.c_str(), topSalaries[i].salary);
+    }
+    
+    // Longest repairs currently in progress
+    row += 2;
+    attron(COLOR_PAIR(3) | A_BOLD);
+    mvprintw(row++, startX + 2, "Longest Repairs In Progress:");
+    attroff(COLOR_PAIR(3) | A_BOLD);
+    row++;
+    
+    for (size_t i = 0; i < longestRepairs.size() && row < maxY - 6; i++) {
+        const RepairRow& rep = longestRepairs[i];
+        mvprintw(row++, startX + 4, "%zu. Request #%-6d Tech %-5d %4d ticks (%d left)", i + 1,
+                 rep.id, rep.technician, rep.duration, rep.remaining);
+    }
     
     mvprintw(maxY - 5, startX + 2, "Press ESC to return to main menu");
 }
 
-void ServiceManagerTUI::handleInput() {
+bool ServiceManagerTUI::handleInput() {
     int ch = getch();
     
+    if (ch == ERR) {
+        return false;
+    }
+    
     if (ch == 'q' || ch == 'Q') {
         running = false;
-        return;
+        return true;
+    }
+    
+    if (ch == '+' || ch == '=') {
+        changeSpeed(1);
+        return true;
+    }
+    
+    if (ch == '-' || ch == '_') {
+        changeSpeed(-1);
+        return true;
+    }
+    
+    if (currentMenu == MenuState::ViewProfiler && (ch == 'r' || ch == 'R')) {
+        std::lock_guard<std::mutex> lock(managerMutex);
+        Profiler::getInstance().reset();
+        contentValid = false;
+        return true;
+    }
+    
+    if (currentMenu == MenuState::ViewProfiler && (ch == 'd' || ch == 'D')) {
+        bool written;
+        {
+            std::lock_guard<std::mutex> lock(managerMutex);
+            written = Profiler::getInstance().dump("profile.csv");
+        }
+        showMessage(written ? "Profile written to profile.csv" : "Could not write profile.csv");
+        clear();
+        invalidateUI();
+        return true;
     }
     
     if (ch == 27) { // ESC
@@ -326,13 +598,13 @@ void ServiceManagerTUI::handleInput() {
             currentMenu = MenuState::Main;
             selectedItem = 0;
         }
-        return;
+        return true;
     }
     
     // Get max items for current menu
     int maxItems = 0;
     switch (currentMenu) {
-        case MenuState::Main: maxItems = 4; break;
+        case MenuState::Main: maxItems = 5; break;
         case MenuState::EmployeeManagement: maxItems = 6; break;
         case MenuState::RequestManagement: maxItems = 5; break;
         default: maxItems = 1; break;
@@ -350,8 +622,19 @@ void ServiceManagerTUI::handleInput() {
         case 10: // ENTER
         case KEY_ENTER:
             handleSelection();
+            // Forms and dialogs paint over the whole screen
+            clear();
+            invalidateUI();
+            break;
+            
+        case KEY_RESIZE:
+            getmaxyx(stdscr, maxY, maxX);
+            clear();
+            invalidateUI();
             break;
     }
+    
+    return true;
 }
 
 void ServiceManagerTUI::handleSelection() {
@@ -370,6 +653,10 @@ void ServiceManagerTUI::handleSelection() {
                 selectedItem = 0;
                 break;
             case 3:
+                currentMenu = MenuState::ViewProfiler;
+                selectedItem = 0;
+                break;
+            case 4:
                 running = false;
                 break;
         }
@@ -444,6 +731,7 @@ void ServiceManagerTUI::showAddTechnicianForm() {
     Address residence = getAddressInput(row, startX);
     
     int techId;
+    bool added;
     {
         std::lock_guard<std::mutex> lock(managerMutex);
         auto technician = EmployeeFactory::createTechnician(
@@ -479,10 +767,11 @@ void ServiceManagerTUI::showAddTechnicianForm() {
             }
         }
         
-        manager.addEmployee(std::move(technician));
+        added = manager.addEmployee(std::move(technician));
     }
     
-    showMessage("Technician added successfully!");
+    showMessage(added ? "Technician added successfully!"
+                      : "CNP is malformed or already in use!");
     
     noecho();
     curs_set(0);
@@ -528,15 +817,17 @@ void ServiceManagerTUI::showAddReceptionistForm() {
     mvprintw(row++, startX, "RESIDENCE ADDRESS:");
     Address residence = getAddressInput(row, startX);
     
+    bool added;
     {
         std::lock_guard<std::mutex> lock(managerMutex);
         auto receptionist = EmployeeFactory::createReceptionist(
             firstName, lastName, cnp, hireDate, std::move(residence)
         );
-        manager.addEmployee(std::move(receptionist));
+        added = manager.addEmployee(std::move(receptionist));
     }
     
-    showMessage("Receptionist added successfully!");
+    showMessage(added ? "Receptionist added successfully!"
+                      : "CNP is malformed or already in use!");
     
     noecho();
     curs_set(0);
@@ -582,15 +873,17 @@ void ServiceManagerTUI::showAddSupervisorForm() {
     mvprintw(row++, startX, "RESIDENCE ADDRESS:");
     Address residence = getAddressInput(row, startX);
     
+    bool added;
     {
         std::lock_guard<std::mutex> lock(managerMutex);
         auto supervisor = EmployeeFactory::createSupervisor(
             firstName, lastName, cnp, hireDate, std::move(residence)
         );
-        manager.addEmployee(std::move(supervisor));
+        added = manager.addEmployee(std::move(supervisor));
     }
     
-    showMessage("Supervisor added successfully!");
+    showMessage(added ? "Supervisor added successfully!"
+                      : "CNP is malformed or already in use!");
     
     noecho();
     curs_set(0);
@@ -612,12 +905,13 @@ void ServiceManagerTUI::showRemoveEmployeeDialog() {
     
     int id = getIntInput("Enter Employee ID to remove: ", 7, startX);
     
+    bool removed;
     {
         std::lock_guard<std::mutex> lock(managerMutex);
-        manager.removeEmployeeById(id);
+        removed = manager.removeEmployeeById(id);
     }
     
-    showMessage("Employee removed successfully!");
+    showMessage(removed ? "Employee removed successfully!" : "Employee not found!");
     
     noecho();
     curs_set(0);
@@ -735,43 +1029,132 @@ void ServiceManagerTUI::showViewRequestDialog() {
 }
 
 void ServiceManagerTUI::showListRequests() {
-    clearContent();
-    nodelay(stdscr, FALSE);
-    
-    std::lock_guard<std::mutex> lock(managerMutex);
-    
+    showRequestBrowser(std::nullopt);
+}
+
+void ServiceManagerTUI::showRequestBrowser(std::optional<Status> status) {
+    // Virtualized list: only the rows that fit on screen are fetched from the
+    // manager, starting at the id of the first visible row
     int startX = 4;
+    int firstRow = 8;
+    int visibleRows = std::max(1, maxY - 6 - firstRow);
+    int topId = std::numeric_limits<int>::min();
+    std::uint64_t drawnGeneration = 0;
+    bool dirty = true;
     
-    attron(COLOR_PAIR(2) | A_BOLD);
-    mvprintw(4, startX, "ALL REPAIR REQUESTS");
-    attroff(COLOR_PAIR(2) | A_BOLD);
-    mvhline(5, startX, ACS_HLINE, 70);
-    
-    int row = 7;
-    
-    auto statuses = {Status::Received, Status::Pending, Status::InProgress, 
-                     Status::Completed, Status::Rejected};
+    // Follow the simulation through the same wakeups as the other screens
+    nodelay(stdscr, TRUE);
     
-    for (auto status : statuses) {
-        auto requests = manager.filter(status);
+    bool done = false;
+    while (!done) {
+        manager.armChangeListener();
+        std::uint64_t generation = manager.getGeneration();
         
-        if (!requests.empty()) {
+        if (dirty || generation != drawnGeneration) {
+            struct Row { int id; Status status; std::string appliance; int technician; int remaining; };
+            std::vector<Row> rows;
+            std::size_t total;
+            {
+                std::lock_guard<std::mutex> lock(managerMutex);
+                total = manager.countRequests(status);
+                for (const RepairRequest* req : manager.getRequestsFrom(topId, visibleRows, status)) {
+                    const Appliance& app = req->getAppliance();
+                    rows.push_back({req->getId(), req->getStatus(),
+                                    applianceTypeToString(app.getType()) + " " + app.getBrand() + " " + app.getModel(),
+                                    req->getTechnicianId(), req->getRemainingTime()});
+                }
+            }
+            
+            clearContent();
+            attron(COLOR_PAIR(2) | A_BOLD);
+            if (status) {
+                mvprintw(4, startX, "REPAIR REQUESTS - %s (%zu)", statusToString(*status).c_str(), total);
+            } else {
+                mvprintw(4, startX, "ALL REPAIR REQUESTS (%zu)", total);
+            }
+            attroff(COLOR_PAIR(2) | A_BOLD);
+            mvhline(5, startX, ACS_HLINE, 70);
+            
             attron(A_BOLD | COLOR_PAIR(1));
-            mvprintw(row++, startX, "%s (%zu):", statusToString(status).c_str(), requests.size());
+            mvprintw(6, startX, "%-8s %-12s %-32s %-6s %s", "ID", "Status", "Appliance", "Tech", "Left");
             attroff(A_BOLD | COLOR_PAIR(1));
             
-            for (int id : requests) {
-                mvprintw(row++, startX + 2, "Request #%d", id);
-                if (row > maxY - 6) {
-                    mvprintw(row++, startX + 2, "... (more requests)");
+            int row = firstRow;
+            for (const Row& r : rows) {
+                mvprintw(row++, startX, "%-8d %-12s %-32.32s %-6d %d", r.id, statusToString(r.status).c_str(),
+                         r.appliance.c_str(), r.technician, r.remaining);
+            }
+            if (rows.empty()) {
+                mvprintw(row, startX, "No requests to show.");
+            }
+            
+            attron(A_DIM);
+            mvprintw(maxY - 5, startX, "UP/DOWN Scroll | PGUP/PGDN Page | HOME/END | G Jump to ID | ESC Back");
+            attroff(A_DIM);
+            refresh();
+            
+            drawnGeneration = generation;
+            dirty = false;
+        }
+        
+        waitForEvents();
+        
+        int ch;
+        while (!done && (ch = getch()) != ERR) {
+            if (ch == 27 || ch == 'q' || ch == 'Q') {
+                done = true;
+                break;
+            }
+            dirty = true;
+            
+            // Typing the id must not hold up the tick thread, so no lock here
+            if (ch == 'g' || ch == 'G') {
+                nodelay(stdscr, FALSE);
+                echo();
+                curs_set(1);
+                move(maxY - 5, startX);
+                clrtoeol();
+                topId = getIntInput("Jump to request ID: ", maxY - 5, startX);
+                noecho();
+                curs_set(0);
+                nodelay(stdscr, TRUE);
+                continue;
+            }
+            
+            std::lock_guard<std::mutex> lock(managerMutex);
+            switch (ch) {
+                case KEY_DOWN: {
+                    auto next = manager.getRequestsFrom(topId, 2, status);
+                    if (next.size() == 2) topId = next[1]->getId();
+                    break;
+                }
+                case KEY_UP: {
+                    auto prev = manager.getRequestsBefore(topId, 1, status);
+                    if (!prev.empty()) topId = prev[0]->getId();
+                    break;
+                }
+                case KEY_NPAGE: {
+                    auto next = manager.getRequestsFrom(topId, visibleRows + 1, status);
+                    if (static_cast<int>(next.size()) > visibleRows) topId = next[visibleRows]->getId();
+                    break;
+                }
+                case KEY_PPAGE: {
+                    auto prev = manager.getRequestsBefore(topId, visibleRows, status);
+                    if (!prev.empty()) topId = prev.front()->getId();
+                    break;
+                }
+                case KEY_HOME:
+                    topId = std::numeric_limits<int>::min();
+                    break;
+                case KEY_END: {
+                    auto last = manager.getRequestsBefore(std::numeric_limits<int>::max(), visibleRows, status);
+                    if (!last.empty()) topId = last.front()->getId();
                     break;
                 }
             }
-            row++;
         }
     }
     
-    waitForKey();
     nodelay(stdscr, TRUE);
 }
 
@@ -807,31 +1190,10 @@ void ServiceManagerTUI::showFilterRequestsDialog() {
     
     Status status = static_cast<Status>(statusInt);
     
-    clearContent();
-    attron(COLOR_PAIR(2) | A_BOLD);
-    mvprintw(4, startX, "FILTERED RESULTS - %s", statusToString(status).c_str());
-    attroff(COLOR_PAIR(2) | A_BOLD);
-    mvhline(5, startX, ACS_HLINE, 50);
-    
-    {
-        std::lock_guard<std::mutex> lock(managerMutex);
-        auto requests = manager.filter(status);
-        
-        int row = 7;
-        mvprintw(row++, startX, "Found %zu requests:", requests.size());
-        row++;
-        
-        for (int id : requests) {
-            mvprintw(row++, startX + 2, "Request #%d", id);
-            if (row > maxY - 6) break;
-        }
-    }
-    
-    waitForKey();
-    
     noecho();
     curs_set(0);
-    nodelay(stdscr, TRUE);
+    
+    showRequestBrowser(status);
 }
 
 // Helper Methods
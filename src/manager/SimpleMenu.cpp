@@ -153,13 +153,7 @@ void SimpleMenu::addTechnician() {
         lastName = getStringInput("Last Name (3-30 chars): ");
     }
     
-    std::string cnp;
-    do {
-        cnp = getStringInput("CNP (13 digits): ");
-        if (!CNPValidator::isValid(cnp)) {
-            std::cout << "Error: " << CNPValidator::getValidationError(cnp) << "\n";
-        }
-    } while (!CNPValidator::isValid(cnp));
+    std::string cnp = inputNewCNP();
     
     std::cout << "\nDate of Hiring:\n";
     auto dateOfHiring = inputDate();
@@ -197,8 +191,11 @@ void SimpleMenu::addTechnician() {
     }
     
     int id = technician->getId();
-    manager.addEmployee(std::move(technician));
-    std::cout << "\nTechnician added successfully! ID: " << id << "\n";
+    if (manager.addEmployee(std::move(technician))) {
+        std::cout << "\nTechnician added successfully! ID: " << id << "\n";
+    } else {
+        std::cout << "\nError: Technician was not added, its ID or CNP is already in use.\n";
+    }
     pause();
 }
 
@@ -218,13 +215,7 @@ void SimpleMenu::addReceptionist() {
         lastName = getStringInput("Last Name (3-30 chars): ");
     }
     
-    std::string cnp;
-    do {
-        cnp = getStringInput("CNP (13 digits): ");
-        if (!CNPValidator::isValid(cnp)) {
-            std::cout << "Error: " << CNPValidator::getValidationError(cnp) << "\n";
-        }
-    } while (!CNPValidator::isValid(cnp));
+    std::string cnp = inputNewCNP();
     
     std::cout << "\nDate of Hiring:\n";
     auto dateOfHiring = inputDate();
@@ -237,8 +228,11 @@ void SimpleMenu::addReceptionist() {
     );
     
     int id = receptionist->getId();
-    manager.addEmployee(std::move(receptionist));
-    std::cout << "\nReceptionist added successfully! ID: " << id << "\n";
+    if (manager.addEmployee(std::move(receptionist))) {
+        std::cout << "\nReceptionist added successfully! ID: " << id << "\n";
+    } else {
+        std::cout << "\nError: Receptionist was not added, its ID or CNP is already in use.\n";
+    }
     pause();
 }
 
@@ -258,13 +252,7 @@ void SimpleMenu::addSupervisor() {
         lastName = getStringInput("Last Name (3-30 chars): ");
     }
     
-    std::string cnp;
-    do {
-        cnp = getStringInput("CNP (13 digits): ");
-        if (!CNPValidator::isValid(cnp)) {
-            std::cout << "Error: " << CNPValidator::getValidationError(cnp) << "\n";
-        }
-    } while (!CNPValidator::isValid(cnp));
+    std::string cnp = inputNewCNP();
     
     std::cout << "\nDate of Hiring:\n";
     auto dateOfHiring = inputDate();
@@ -277,8 +265,11 @@ void SimpleMenu::addSupervisor() {
     );
     
     int id = supervisor->getId();
-    manager.addEmployee(std::move(supervisor));
-    std::cout << "\nSupervisor added successfully! ID: " << id << "\n";
+    if (manager.addEmployee(std::move(supervisor))) {
+        std::cout << "\nSupervisor added successfully! ID: " << id << "\n";
+    } else {
+        std::cout << "\nError: Supervisor was not added, its ID or CNP is already in use.\n";
+    }
     pause();
 }
 
@@ -297,13 +288,11 @@ void SimpleMenu::listEmployees() {
             std::cout << "Name: " << emp->getFirstName() << " " << emp->getLastName() << "\n";
             std::cout << "Type: " << employeeTypeToString(emp->getType()) << "\n";
             
-            // Calculate and set salary before displaying
-            const_cast<Employee*>(emp.get())->setSalary();
             std::cout << "Salary: " << emp->getSalary() << " RON\n";
             
             // Show additional info for technicians
             if (emp->getType() == EmployeeType::Technician) {
-                Technician* tech = dynamic_cast<Technician*>(emp.get());
+                Technician* tech = dynamic_cast<Technician*>(emp);
                 if (tech) {
                     const std::vector<Skill>& skills = tech->getSkills();
                     if (!skills.empty()) {
@@ -331,8 +320,9 @@ void SimpleMenu::searchEmployeeByCNP() {
     std::string cnp = getStringInput("Enter CNP (13 digits): ");
     
     // Validate CNP
-    if (!CNPValidator::isValid(cnp)) {
-        std::cout << "\nError: " << CNPValidator::getValidationError(cnp) << "\n";
+    CNPError cnpError = CNPValidator::validate(cnp).error;
+    if (cnpError != CNPError::None) {
+        std::cout << "\nError: " << CNPValidator::errorMessage(cnpError) << "\n";
         pause();
         return;
     }
@@ -357,8 +347,7 @@ void SimpleMenu::searchEmployeeByCNP() {
         const Address& addr = emp->getResidence();
         std::cout << "City: " << addr.getCity() << "\n";
         
-        // Calculate and display salary
-        emp->setSalary();
+        // Display salary
         std::cout << "Current Salary: " << emp->getSalary() << " RON\n";
         
         // Type-specific information
@@ -378,7 +367,7 @@ void SimpleMenu::searchEmployeeByCNP() {
         } else if (emp->getType() == EmployeeType::Receptionist) {
             Receptionist* rec = dynamic_cast<Receptionist*>(emp);
             if (rec) {
-                std::vector<int> requests = rec->getReceivedRepairRequests();
+                const std::vector<int>& requests = rec->getReceivedRepairRequests();
                 std::cout << "Total Received Requests: " << requests.size() << "\n";
             }
         }
@@ -396,8 +385,9 @@ void SimpleMenu::modifyEmployeeName() {
     std::string cnp = getStringInput("Enter employee CNP: ");
     
     // Validate CNP
-    if (!CNPValidator::isValid(cnp)) {
-        std::cout << "\nError: " << CNPValidator::getValidationError(cnp) << "\n";
+    CNPError cnpError = CNPValidator::validate(cnp).error;
+    if (cnpError != CNPError::None) {
+        std::cout << "\nError: " << CNPValidator::errorMessage(cnpError) << "\n";
         pause();
         return;
     }
@@ -505,6 +495,7 @@ void SimpleMenu::handleRepairRequestMenu() {
     std::cout << "1. Add Repair Request\n";
     std::cout << "2. List All Repair Requests\n";
     std::cout << "3. List by Status\n";
+    std::cout << "4. Import Requests from JSONL\n";
     std::cout << "0. Back\n";
     
     int subChoice = getIntInput("Enter choice: ");
@@ -517,6 +508,9 @@ void SimpleMenu::handleRepairRequestMenu() {
     } else if (subChoice == 3) {
         clearScreen();
         listRequestsByStatus();
+    } else if (subChoice == 4) {
+        clearScreen();
+        importRepairRequests();
     }
 }
 
@@ -582,6 +576,23 @@ void SimpleMenu::addRepairRequest() {
     pause();
 }
 
+void SimpleMenu::importRepairRequests() {
+    clearScreen();
+    std::cout << "\n=== Import Repair Requests ===\n";
+    std::cout << "One JSON object per line, e.g.\n";
+    std::cout << "{\"type\":\"TV\",\"brand\":\"Sony\",\"model\":\"X1\",\"year\":2015,\"catalog_price\":3000,"
+                 "\"diagonal\":55,\"unit\":\"inch\",\"complexity\":2,\"receptionist_id\":9}\n\n";
+    
+    std::string file = getStringInput("JSONL file: ");
+    if (file.empty()) {
+        std::cout << "\nNo file given.\n";
+    } else if (!manager.importRepairRequestsFromJSONL(requestFactory, file)) {
+        std::cout << "\nError: Failed to import requests.\n";
+    }
+    
+    pause();
+}
+
 void SimpleMenu::listRepairRequests() {
     clearScreen();
     std::cout << "\n=== All Repair Requests ===\n";
@@ -727,6 +738,7 @@ void SimpleMenu::generateReports() {
     std::cout << "2. Technician with Longest Repair\n";
     std::cout << "3. Pending Requests by Appliance\n";
     std::cout << "4. Generate All Reports\n";
+    std::cout << "5. Top K Employees by Salary\n";
     std::cout << "0. Back\n";
     
     int choice = getIntInput("Enter choice: ");
@@ -780,6 +792,23 @@ void SimpleMenu::generateReports() {
             }
             break;
         }
+        case 5: {
+            int k = getIntInput("How many employees (K): ");
+            if (k <= 0) {
+                std::cout << "\nInvalid K.\n";
+                break;
+            }
+            
+            std::string filename = getStringInput("Output filename (default: top_salaries.csv): ");
+            if (filename.empty()) filename = "top_salaries.csv";
+            
+            if (manager.generateTopSalariesReport(filename, k)) {
+                std::cout << "\nReport generated successfully!\n";
+            } else {
+                std::cout << "\nError generating report.\n";
+            }
+            break;
+        }
         case 0:
             return;
         default:
@@ -825,7 +854,7 @@ void SimpleMenu::loadData() {
     if (manager.loadFromCSV(requestFactory, empFile, reqFile)) {
         std::cout << "\nData loaded successfully!\n";
     } else {
-        std::cout << "\nError: Failed to load data.\n";
+        std::cout << "\nError: Data could not be fully loaded (see the messages above).\n";
     }
     
     pause();
@@ -839,73 +868,33 @@ void SimpleMenu::showStatistics() {
     clearScreen();
     std::cout << "\n=== Service Statistics ===\n";
     
-    const auto& employees = manager.getEmployees();
-    const auto& requests = manager.getRepairRequests();
+    // All aggregates are maintained by the manager, no need to scan anything
+    ServiceStats stats = manager.getStats();
     
-    // Count employees by type
-    int techCount = 0, recepCount = 0, supervCount = 0;
-    for (const auto& emp : employees) {
-        switch (emp->getType()) {
-            case EmployeeType::Technician: techCount++; break;
-            case EmployeeType::Receptionist: recepCount++; break;
-            case EmployeeType::Supervisor: supervCount++; break;
-        }
-    }
-    
-    // Count requests by status
-    int receivedCount = 0, pendingCount = 0, inProgressCount = 0, completedCount = 0, rejectedCount = 0;
-    for (const auto& req : requests) {
-        switch (req->getStatus()) {
-            case Status::Received: receivedCount++; break;
-            case Status::Pending: pendingCount++; break;
-            case Status::InProgress: inProgressCount++; break;
-            case Status::Completed: completedCount++; break;
-            case Status::Rejected: rejectedCount++; break;
-        }
-    }
+    auto byType = [&stats](EmployeeType type) { return stats.employees_by_type[static_cast<size_t>(type)]; };
+    auto byStatus = [&stats](Status status) { return stats.requests_by_status[static_cast<size_t>(status)]; };
     
     std::cout << "\n--- Employees ---\n";
-    std::cout << "Total: " << employees.size() << "\n";
-    std::cout << "  Technicians: " << techCount << "\n";
-    std::cout << "  Receptionists: " << recepCount << "\n";
-    std::cout << "  Supervisors: " << supervCount << "\n";
+    std::cout << "Total: " << stats.total_employees << "\n";
+    std::cout << "  Technicians: " << byType(EmployeeType::Technician) << "\n";
+    std::cout << "  Receptionists: " << byType(EmployeeType::Receptionist) << "\n";
+    std::cout << "  Supervisors: " << byType(EmployeeType::Supervisor) << "\n";
     
     std::cout << "\n--- Repair Requests ---\n";
-    std::cout << "Total: " << requests.size() << "\n";
-    std::cout << "  Received: " << receivedCount << "\n";
-    std::cout << "  Pending: " << pendingCount << "\n";
-    std::cout << "  In Progress: " << inProgressCount << "\n";
-    std::cout << "  Completed: " << completedCount << "\n";
-    std::cout << "  Rejected: " << rejectedCount << "\n";
-    
-    // Calculate total revenue from completed requests
-    int totalRevenue = 0;
-    for (const auto& req : requests) {
-        if (req->getStatus() == Status::Completed) {
-            totalRevenue += req->getPrice();
-        }
-    }
+    std::cout << "Total: " << stats.total_requests << "\n";
+    std::cout << "  Received: " << byStatus(Status::Received) << "\n";
+    std::cout << "  Pending: " << byStatus(Status::Pending) << "\n";
+    std::cout << "  In Progress: " << byStatus(Status::InProgress) << "\n";
+    std::cout << "  Completed: " << byStatus(Status::Completed) << "\n";
+    std::cout << "  Rejected: " << byStatus(Status::Rejected) << "\n";
     
     std::cout << "\n--- Financial ---\n";
-    std::cout << "Total Revenue (Completed): " << totalRevenue << " RON\n";
-    
-    // Calculate total salary expenses (make sure salaries are calculated)
-    int totalSalaries = 0;
-    for (const auto& emp : employees) {
-        const_cast<Employee*>(emp.get())->setSalary();
-        totalSalaries += emp->getSalary();
-    }
-    std::cout << "Total Monthly Salaries: " << totalSalaries << " RON\n";
+    std::cout << "Total Revenue (Completed): " << stats.completed_revenue << " RON\n";
+    std::cout << "Total Monthly Salaries: " << stats.total_salaries << " RON\n";
     
     // Show active work
     std::cout << "\n--- Active Work ---\n";
-    int totalRemainingTicks = 0;
-    for (const auto& req : requests) {
-        if (req->getStatus() == Status::InProgress) {
-            totalRemainingTicks += req->getRemainingTime();
-        }
-    }
-    std::cout << "Total Remaining Work: " << totalRemainingTicks << " ticks\n";
+    std::cout << "Total Remaining Work: " << stats.remaining_ticks << " ticks\n";
     
     pause();
 }
@@ -991,6 +980,29 @@ std::chrono::year_month_day SimpleMenu::inputDate() {
     };
 }
 
+std::string SimpleMenu::inputNewCNP() {
+    while (true) {
+        std::string cnp = getStringInput("CNP (13 digits): ");
+        CNPInfo cnpInfo = CNPValidator::validate(cnp);
+        if (!cnpInfo.isValid()) {
+            std::cout << "Error: " << CNPValidator::errorMessage(cnpInfo.error) << "\n";
+        } else if (Employee* existing = manager.findEmployeeByCNP(cnp)) {
+            std::cout << "Error: CNP already belongs to employee " << existing->getId() << "\n";
+        } else {
+            printCNPInfo(cnpInfo);
+            return cnp;
+        }
+    }
+}
+
+void SimpleMenu::printCNPInfo(const CNPInfo& info) {
+    std::cout << "Born " << static_cast<int>(info.birth_date.year()) << "-"
+              << std::setw(2) << std::setfill('0') << static_cast<unsigned>(info.birth_date.month()) << "-"
+              << std::setw(2) << static_cast<unsigned>(info.birth_date.day()) << std::setfill(' ')
+              << ", " << (info.sex == 9 ? "foreign citizen" : info.sex % 2 ? "male" : "female")
+              << ", county " << info.county << "\n";
+}
+
 void SimpleMenu::clearScreen() {
     #ifdef _WIN32
         system("cls");
@@ -0,0 +1,91 @@
+#include "TickScheduler.hpp"
+
+#include <algorithm>
+
+TickScheduler::TickScheduler(double speed)
+:   speed(speed),
+    stopped(false),
+    next_deadline(std::chrono::steady_clock::now())
+{}
+
+std::chrono::steady_clock::duration TickScheduler::period() const {
+    if (speed <= MAX_SPEED) return std::chrono::steady_clock::duration::zero();
+    return std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(1.0 / speed));
+}
+
+void TickScheduler::setSpeed(double new_speed) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        // Negative or NaN means unthrottled; anything slower than MIN_SPEED is clamped
+        if (!(new_speed > MAX_SPEED)) speed = MAX_SPEED;
+        else speed = std::max(new_speed, MIN_SPEED);
+        // Start the new pace from now instead of from a deadline planned at the old pace
+        next_deadline = std::chrono::steady_clock::now() + period();
+    }
+    wakeup.notify_all();
+}
+
+double TickScheduler::getSpeed() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return speed;
+}
+
+void TickScheduler::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopped = true;
+    }
+    wakeup.notify_all();
+}
+
+bool TickScheduler::isStopped() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stopped;
+}
+
+bool TickScheduler::waitForNextTick() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    // Sleep until the deadline; a speed change or stop() wakes us early
+    // and the deadline is re-read
+    while (!stopped && std::chrono::steady_clock::now() < next_deadline) {
+        wakeup.wait_until(lock, next_deadline);
+    }
+    if (stopped) return false;
+
+    auto now = std::chrono::steady_clock::now();
+    auto step = period();
+    next_deadline += step;
+
+    // Behind by more than one period: drop the missed deadlines instead of
+    // running them back to back
+    if (step > std::chrono::steady_clock::duration::zero() && next_deadline < now) {
+        timing.coalesced += (now - next_deadline) / step + 1;
+        next_deadline = now + step;
+    } else if (step == std::chrono::steady_clock::duration::zero()) {
+        next_deadline = now;
+    }
+    return true;
+}
+
+void TickScheduler::recordTick(std::chrono::steady_clock::duration latency) {
+    std::lock_guard<std::mutex> lock(mutex);
+    timing.latency.record(std::chrono::duration_cast<std::chrono::nanoseconds>(latency));
+    timing.ticks++;
+
+    auto step = period();
+    if (step > std::chrono::steady_clock::duration::zero() && latency > step) {
+        timing.overruns++;
+    }
+}
+
+TickTimingStats TickScheduler::getTimingStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return timing;
+}
+
+void TickScheduler::resetTimingStats() {
+    std::lock_guard<std::mutex> lock(mutex);
+    timing = TickTimingStats{};
+}
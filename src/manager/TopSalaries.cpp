@@ -0,0 +1,45 @@
+#include "TopSalaries.hpp"
+
+#include <algorithm>
+
+TopSalaries::TopSalaries(std::size_t k, std::size_t candidates): k(k) {
+    heap.reserve(std::min(k, candidates));
+}
+
+bool TopSalaries::ranksBefore(const Employee* a, const Employee* b) {
+    int a_salary = a->getSalary();
+    int b_salary = b->getSalary();
+    if (a_salary != b_salary) {
+        return a_salary > b_salary;
+    }
+    // Names are only compared on salary ties
+    if (a->getLastName() != b->getLastName()) {
+        return a->getLastName() < b->getLastName();
+    }
+    return a->getFirstName() < b->getFirstName();
+}
+
+void TopSalaries::offer(const Employee* employee) {
+    if (k == 0 || !employee) return;
+
+    // With ranksBefore as the heap ordering, the front is the lowest ranked employee
+    if (heap.size() < k) {
+        heap.push_back(employee);
+        std::push_heap(heap.begin(), heap.end(), ranksBefore);
+        return;
+    }
+
+    if (ranksBefore(employee, heap.front())) {
+        std::pop_heap(heap.begin(), heap.end(), ranksBefore);
+        heap.back() = employee;
+        std::push_heap(heap.begin(), heap.end(), ranksBefore);
+    }
+}
+
+std::size_t TopSalaries::size() const { return heap.size(); }
+
+std::vector<const Employee*> TopSalaries::sorted() const {
+    std::vector<const Employee*> result = heap;
+    std::sort(result.begin(), result.end(), ranksBefore);
+    return result;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <iostream>
+
+// ============================================================================
+// MINIMAL TEST CHECKS
+// ============================================================================
+
+// Every tests/<name>/test.cpp is a standalone program run by `make test`.
+// A failed CHECK prints where it happened and the program exits non-zero
+// through checkResult() at the end of main.
+
+inline int& checkFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+#define CHECK(condition)                                                        \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK failed: "      \
+                      << #condition << "\n";                                    \
+            checkFailures()++;                                                  \
+        }                                                                       \
+    } while (false)
+
+inline int checkResult(const char* name) {
+    if (checkFailures() == 0) {
+        std::cerr << name << ": all checks passed\n";
+        return 0;
+    }
+    std::cerr << name << ": " << checkFailures() << " check(s) failed\n";
+    return 1;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ServiceManager.hpp"
+#include "EmployeeFactory.hpp"
+#include "AddressFactory.hpp"
+#include "ApplianceFactory.hpp"
+#include "RepairRequestFactory.hpp"
+
+// ============================================================================
+// TEST FIXTURES
+// ============================================================================
+
+// Small builders shared by the tests that drive the ServiceManager singleton.
+// Every call hands out a fresh 13-digit CNP, so employees never collide.
+
+inline std::string nextTestCNP() {
+    static long long serial = 1000000000000;
+    return std::to_string(serial++);
+}
+
+inline Technician* hireTechnician(ServiceManager& manager,
+                                  const std::vector<std::pair<ApplianceType, std::string>>& skills) {
+    auto address = AddressFactory::createAddressHouse("Romania", "Cluj", "Cluj-Napoca", "Test", "1");
+    auto employee = EmployeeFactory::createTechnician(
+        "Test", "Technician", nextTestCNP(),
+        std::chrono::year_month_day{std::chrono::year{2020}, std::chrono::January, std::chrono::day{1}}, *address);
+    Technician* tech = static_cast<Technician*>(employee.get());
+    for (const auto& [type, brand] : skills) {
+        tech->addSkill(type, brand);
+    }
+    return manager.addEmployee(std::move(employee)) ? tech : nullptr;
+}
+
+inline int hireReceptionist(ServiceManager& manager) {
+    auto address = AddressFactory::createAddressHouse("Romania", "Cluj", "Cluj-Napoca", "Test", "2");
+    auto employee = EmployeeFactory::createReceptionist(
+        "Test", "Receptionist", nextTestCNP(),
+        std::chrono::year_month_day{std::chrono::year{2020}, std::chrono::January, std::chrono::day{1}}, *address);
+    int id = employee->getId();
+    return manager.addEmployee(std::move(employee)) ? id : 0;
+}
+
+// A fridge needing `duration` ticks of work, straight into the Pending queue
+inline int addPendingRequest(ServiceManager& manager, RepairRequestFactory& factory, int receptionist_id,
+                             const std::string& brand, int duration = 5,
+                             ApplianceType type = ApplianceType::Fridge) {
+    std::unique_ptr<Appliance> appliance;
+    switch (type) {
+        case ApplianceType::Fridge:
+            appliance = ApplianceFactory::createApplianceFridge(brand, "Model", 2020, 1000, true);
+            break;
+        case ApplianceType::TV:
+            appliance = ApplianceFactory::createApplianceTV(brand, "Model", 2020, 1000, 50, DiagonalUnit::Inches);
+            break;
+        case ApplianceType::WashingMachine:
+            appliance = ApplianceFactory::createApplianceWashingMachine(brand, "Model", 2020, 1000, 7);
+            break;
+    }
+    static int next_id = 1;
+    auto request = factory.createRepairRequestFromCSV(
+        next_id++, std::move(appliance), manager.getClock().now(), 1, duration, duration, 100,
+        Status::Pending, receptionist_id, 0);
+    int id = request->getId();
+    manager.addRepairRequest(std::move(request));
+    return id;
+}
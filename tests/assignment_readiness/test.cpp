@@ -0,0 +1,151 @@
+// Skill-bucket readiness: a pending request that found no technician is not
+// looked at again until something can change that. Each event that makes a
+// bucket ready must get a blocked request assigned on the next pass.
+
+#include "Check.hpp"
+#include "TestService.hpp"
+
+namespace {
+    constexpr int MAX_ACTIVE = 3;  // ServiceManager::MAX_ACTIVE_REQUESTS
+
+    ServiceManager& freshManager() {
+        ServiceManager& manager = ServiceManager::getInstance();
+        manager.clear();
+        manager.setSchedulingPolicy(SchedulingPolicy::create(SchedulingPolicyKind::FirstCome));
+        manager.setAssignmentMode(AssignmentMode::Greedy);
+        return manager;
+    }
+
+    Status statusOf(ServiceManager& manager, int request_id) {
+        return manager.findRepairRequestById(request_id)->getStatus();
+    }
+
+    void arrival() {
+        ServiceManager& manager = freshManager();
+        RepairRequestFactory factory(1);
+        int receptionist = hireReceptionist(manager);
+        CHECK(hireTechnician(manager, {{ApplianceType::Fridge, "RdArrival"}}));
+
+        // Nothing to do, then a request comes in
+        manager.autoAssignRequests();
+        int request = addPendingRequest(manager, factory, receptionist, "RdArrival");
+        manager.autoAssignRequests();
+        CHECK(statusOf(manager, request) == Status::InProgress);
+    }
+
+    void slotFreed() {
+        ServiceManager& manager = freshManager();
+        RepairRequestFactory factory(1);
+        int receptionist = hireReceptionist(manager);
+        CHECK(hireTechnician(manager, {{ApplianceType::Fridge, "RdFreed"}}));
+
+        for (int i = 0; i < MAX_ACTIVE; i++) addPendingRequest(manager, factory, receptionist, "RdFreed", 1);
+        int blocked = addPendingRequest(manager, factory, receptionist, "RdFreed", 1);
+        manager.autoAssignRequests();
+        CHECK(statusOf(manager, blocked) == Status::Pending);
+        manager.autoAssignRequests();
+        CHECK(statusOf(manager, blocked) == Status::Pending);
+
+        // The tick assigns first, then the one-tick repairs complete
+        manager.tick();
+        CHECK(statusOf(manager, blocked) == Status::Pending);
+        manager.autoAssignRequests();
+        CHECK(statusOf(manager, blocked) == Status::InProgress);
+    }
+
+    void technicianJoined() {
+        ServiceManager& manager = freshManager();
+        RepairRequestFactory factory(1);
+        int receptionist = hireReceptionist(manager);
+        CHECK(hireTechnician(manager, {{ApplianceType::Fridge, "RdOther"}}));
+
+        int blocked = addPendingRequest(manager, factory, receptionist, "RdJoined");
+        manager.autoAssignRequests();
+        CHECK(statusOf(manager, blocked) == Status::Pending);
+
+        CHECK(hireTechnician(manager, {{ApplianceType::Fridge, "RdJoined"}}));
+        manager.autoAssignRequests();
+        CHECK(statusOf(manager, blocked) == Status::InProgress);
+    }
+
+    void skillLearned() {
+        ServiceManager& manager = freshManager();
+        RepairRequestFactory factory(1);
+        int receptionist = hireReceptionist(manager);
+        Technician* tech = hireTechnician(manager, {{ApplianceType::Fridge, "RdOther"}});
+        CHECK(tech);
+
+        int blocked = addPendingRequest(manager, factory, receptionist, "RdLearned", 5, ApplianceType::TV);
+        manager.autoAssignRequests();
+        CHECK(statusOf(manager, blocked) == Status::Pending);
+
+        // Same brand under another type is not enough
+        tech->addSkill(ApplianceType::Fridge, "RdLearned");
+        manager.autoAssignRequests();
+        CHECK(statusOf(manager, blocked) == Status::Pending);
+
+        tech->addSkill(ApplianceType::TV, "RdLearned");
+        manager.autoAssignRequests();
+        CHECK(statusOf(manager, blocked) == Status::InProgress);
+        CHECK(manager.findRepairRequestById(blocked)->getTechnicianId() == tech->getId());
+    }
+
+    void technicianRemoved() {
+        ServiceManager& manager = freshManager();
+        RepairRequestFactory factory(1);
+        int receptionist = hireReceptionist(manager);
+        Technician* leaving = hireTechnician(manager, {{ApplianceType::Fridge, "RdRemoved"}});
+        CHECK(leaving);
+        int leaving_id = leaving->getId();
+
+        int request = addPendingRequest(manager, factory, receptionist, "RdRemoved");
+        manager.autoAssignRequests();
+        CHECK(manager.findRepairRequestById(request)->getTechnicianId() == leaving_id);
+
+        Technician* staying = hireTechnician(manager, {{ApplianceType::Fridge, "RdRemoved"}});
+        CHECK(staying);
+        int staying_id = staying->getId();
+        manager.autoAssignRequests();
+
+        // Its work goes back to Pending and is picked up by the other technician
+        CHECK(manager.removeEmployeeById(leaving_id));
+        CHECK(statusOf(manager, request) == Status::Pending);
+        manager.autoAssignRequests();
+        CHECK(statusOf(manager, request) == Status::InProgress);
+        CHECK(manager.findRepairRequestById(request)->getTechnicianId() == staying_id);
+    }
+
+    void policyOrderWithinSkill() {
+        // One free slot and three candidates queued under first-come: after
+        // switching policy, the bucket must offer the shortest repair, not
+        // the lowest id
+        ServiceManager& manager = freshManager();
+        RepairRequestFactory factory(1);
+        int receptionist = hireReceptionist(manager);
+        CHECK(hireTechnician(manager, {{ApplianceType::Fridge, "RdKeyed"}, {ApplianceType::Fridge, "RdFiller"}}));
+        for (int i = 0; i < MAX_ACTIVE - 1; i++) addPendingRequest(manager, factory, receptionist, "RdFiller");
+        manager.autoAssignRequests();
+
+        int longest = addPendingRequest(manager, factory, receptionist, "RdKeyed", 9);
+        int shortest = addPendingRequest(manager, factory, receptionist, "RdKeyed", 3);
+        int middle = addPendingRequest(manager, factory, receptionist, "RdKeyed", 6);
+        manager.setSchedulingPolicy(SchedulingPolicy::create(SchedulingPolicyKind::ShortestRepair));
+        manager.autoAssignRequests();
+        CHECK(statusOf(manager, shortest) == Status::InProgress);
+        CHECK(statusOf(manager, middle) == Status::Pending);
+        CHECK(statusOf(manager, longest) == Status::Pending);
+    }
+}
+
+int main() {
+    arrival();
+    slotFreed();
+    technicianJoined();
+    skillLearned();
+    technicianRemoved();
+    policyOrderWithinSkill();
+
+    ServiceManager::getInstance().setSchedulingPolicy(SchedulingPolicy::create(SchedulingPolicyKind::FirstCome));
+    ServiceManager::getInstance().clear();
+    return checkResult("assignment_readiness");
+}
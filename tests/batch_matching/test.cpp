@@ -0,0 +1,181 @@
+// Batch assignment: the augmenting-path matcher on its own, then through the
+// ServiceManager in batch mode, including the greedy fallback on timeout.
+
+#include "Check.hpp"
+#include "TestService.hpp"
+#include "BatchMatcher.hpp"
+
+#include <random>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point NO_DEADLINE = Clock::now() + std::chrono::hours{1};
+
+    // Technicians the matcher sees directly, not managed by the ServiceManager
+    std::unique_ptr<Technician> makeTechnician(const std::vector<std::string>& fridge_brands) {
+        auto address = AddressFactory::createAddressHouse("Romania", "Cluj", "Cluj-Napoca", "Test", "3");
+        auto employee = EmployeeFactory::createTechnician(
+            "Batch", "Technician", nextTestCNP(),
+            std::chrono::year_month_day{std::chrono::year{2020}, std::chrono::January, std::chrono::day{1}}, *address);
+        std::unique_ptr<Technician> tech(static_cast<Technician*>(employee.release()));
+        for (const auto& brand : fridge_brands) tech->addSkill(ApplianceType::Fridge, brand);
+        return tech;
+    }
+
+    std::unique_ptr<RepairRequest> makeRequest(RepairRequestFactory& factory, const std::string& brand) {
+        return factory.createRepairRequest(
+            ApplianceFactory::createApplianceFridge(brand, "Model", 2020, 1000, true), 1, 1, 1);
+    }
+
+    // Largest number of requests that fit, by trying every assignment
+    int bruteForceMaximum(const std::vector<RepairRequest*>& requests, std::size_t count,
+                          const std::vector<std::unique_ptr<Technician>>& techs, std::vector<int>& load,
+                          int max_load, std::size_t next = 0) {
+        if (next == count) return 0;
+        int best = bruteForceMaximum(requests, count, techs, load, max_load, next + 1);
+        for (std::size_t t = 0; t < techs.size(); t++) {
+            if (load[t] < max_load && techs[t]->canRepair(requests[next]->getAppliance())) {
+                load[t]++;
+                best = std::max(best, 1 + bruteForceMaximum(requests, count, techs, load, max_load, next + 1));
+                load[t]--;
+            }
+        }
+        return best;
+    }
+
+    void strandedGeneralist() {
+        // The generalist comes first and is as free as the specialist, so a
+        // greedy pass hands it the first request and strands the second
+        RepairRequestFactory factory(1000);
+        std::vector<std::unique_ptr<Technician>> techs;
+        techs.push_back(makeTechnician({"BmShared", "BmRare"}));
+        techs.push_back(makeTechnician({"BmShared"}));
+        auto shared = makeRequest(factory, "BmShared");
+        auto rare = makeRequest(factory, "BmRare");
+
+        BatchMatcher matcher;
+        const auto& matches = matcher.solve({shared.get(), rare.get()}, techs, 1, NO_DEADLINE);
+        CHECK(!matcher.timedOut());
+        CHECK(matches.size() == 2);
+        CHECK(matches[0] == 1);  // Moved over to the specialist
+        CHECK(matches[1] == 0);
+    }
+
+    void priorityIsNeverDisplaced() {
+        // One slot that both want: the first request keeps it even though
+        // the second one has no other option either
+        RepairRequestFactory factory(2000);
+        std::vector<std::unique_ptr<Technician>> techs;
+        techs.push_back(makeTechnician({"BmShared", "BmRare"}));
+        auto first = makeRequest(factory, "BmShared");
+        auto second = makeRequest(factory, "BmRare");
+
+        BatchMatcher matcher;
+        const auto& matches = matcher.solve({first.get(), second.get()}, techs, 1, NO_DEADLINE);
+        CHECK(matches[0] == 0);
+        CHECK(matches[1] == -1);
+
+        // Randomized: every prefix of the priority order must be matched as
+        // fully as possible. Request k is then matched exactly when it fits
+        // next to the higher-priority ones, i.e. nothing matched earlier is
+        // ever given up for a later request.
+        std::mt19937 rng(11);
+        const std::vector<std::string> brands = {"BmA", "BmB", "BmC", "BmD"};
+        for (int round = 0; round < 200; round++) {
+            int max_load = 1 + static_cast<int>(rng() % 2);
+            std::vector<std::unique_ptr<Technician>> pool;
+            for (int t = 0, n = 1 + static_cast<int>(rng() % 3); t < n; t++) {
+                std::vector<std::string> skills;
+                for (const auto& brand : brands) {
+                    if (rng() % 2) skills.push_back(brand);
+                }
+                pool.push_back(makeTechnician(skills));
+            }
+
+            std::vector<std::unique_ptr<RepairRequest>> owned;
+            std::vector<RepairRequest*> requests;
+            for (int r = 0, n = 1 + static_cast<int>(rng() % 7); r < n; r++) {
+                // Now and then a brand no technician was ever taught
+                owned.push_back(makeRequest(factory, rng() % 10 ? brands[rng() % brands.size()] : "BmNobody"));
+                requests.push_back(owned.back().get());
+            }
+
+            const auto& result = matcher.solve(requests, pool, max_load, NO_DEADLINE);
+            std::vector<int> load(pool.size(), 0);
+            int matched = 0;
+            for (std::size_t r = 0; r < requests.size(); r++) {
+                if (result[r] >= 0) {
+                    CHECK(pool[result[r]]->canRepair(requests[r]->getAppliance()));
+                    load[result[r]]++;
+                    matched++;
+                }
+                std::vector<int> scratch(pool.size(), 0);
+                CHECK(matched == bruteForceMaximum(requests, r + 1, pool, scratch, max_load));
+            }
+            for (int l : load) CHECK(l <= max_load);
+        }
+    }
+
+    void deadline() {
+        RepairRequestFactory factory(3000);
+        std::vector<std::unique_ptr<Technician>> techs;
+        techs.push_back(makeTechnician({"BmShared"}));
+        auto request = makeRequest(factory, "BmShared");
+
+        BatchMatcher matcher;
+        const auto& late = matcher.solve({request.get()}, techs, 1, Clock::now() - std::chrono::seconds{1});
+        CHECK(matcher.timedOut());
+        CHECK(late[0] == -1);
+
+        const auto& on_time = matcher.solve({request.get()}, techs, 1, NO_DEADLINE);
+        CHECK(!matcher.timedOut());
+        CHECK(on_time[0] == 0);
+    }
+
+    // Generalist hired first, then a specialist; three requests of each kind.
+    // Returns how many of the six requests got a technician in one pass.
+    int assignThroughManager(AssignmentMode mode, std::chrono::microseconds budget) {
+        ServiceManager& manager = ServiceManager::getInstance();
+        manager.clear();
+        manager.setAssignmentMode(mode, budget);
+
+        CHECK(hireTechnician(manager, {{ApplianceType::Fridge, "BmShared"}, {ApplianceType::TV, "BmRare"}}));
+        CHECK(hireTechnician(manager, {{ApplianceType::Fridge, "BmShared"}}));
+        int receptionist = hireReceptionist(manager);
+        RepairRequestFactory factory(1);
+        for (int i = 0; i < 3; i++) addPendingRequest(manager, factory, receptionist, "BmShared");
+        for (int i = 0; i < 3; i++) addPendingRequest(manager, factory, receptionist, "BmRare", 5, ApplianceType::TV);
+
+        manager.autoAssignRequests();
+        return static_cast<int>(manager.countRequests(Status::InProgress));
+    }
+
+    void managerBatchAndFallback() {
+        ServiceManager& manager = ServiceManager::getInstance();
+
+        // Greedy fills the generalist with fridges and strands two TVs
+        CHECK(assignThroughManager(AssignmentMode::Greedy, std::chrono::microseconds{0}) == 4);
+        CHECK(manager.getStats().batch_timeouts == 0);
+
+        // Batch moves the fridges to the specialist
+        CHECK(assignThroughManager(AssignmentMode::Batch, std::chrono::seconds{10}) == 6);
+        CHECK(manager.getStats().batch_timeouts == 0);
+
+        // No budget at all: the matcher gives up before the first request,
+        // the pass is counted as timed out and greedy still assigns the rest
+        CHECK(assignThroughManager(AssignmentMode::Batch, std::chrono::microseconds{0}) == 4);
+        CHECK(manager.getStats().batch_timeouts == 1);
+        CHECK(manager.countRequests(Status::Pending) == 2);
+
+        manager.setAssignmentMode(AssignmentMode::Greedy);
+        manager.clear();
+    }
+}
+
+int main() {
+    strandedGeneralist();
+    priorityIsNeverDisplaced();
+    deadline();
+    managerBatchAndFallback();
+    return checkResult("batch_matching");
+}
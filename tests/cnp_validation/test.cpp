@@ -0,0 +1,107 @@
+// The batched CNP validator (SSE2 path plus its scalar tail) must agree with
+// the single-pass CNPValidator::validate() on every record.
+
+#include "Check.hpp"
+#include "CNPValidator.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    // Checksum-valid CNP from its first 12 digits
+    std::string withChecksum(std::string digits) {
+        static const int weights[12] = {2, 7, 9, 1, 4, 6, 3, 5, 8, 2, 7, 9};
+        int sum = 0;
+        for (int i = 0; i < 12; i++) sum += (digits[i] - '0') * weights[i];
+        int checksum = sum % 11;
+        if (checksum == 10) checksum = 1;
+        return digits + static_cast<char>('0' + checksum);
+    }
+
+    // One sample per error class. CNPError::Year cannot come out of 13
+    // digits (every sex digit maps the two year digits into 1800-2099).
+    std::vector<std::pair<std::string, CNPError>> samples() {
+        std::string valid = withChecksum("197031512345");
+        std::string bad_checksum = valid;
+        bad_checksum[12] = static_cast<char>('0' + (valid[12] - '0' + 1) % 10);
+
+        return {
+            {valid, CNPError::None},
+            {withChecksum("600022950001"), CNPError::None},            // 29 Feb 2000
+            {"197031512", CNPError::Length},
+            {"19703151234567", CNPError::Length},
+            {"19703151234a5", CNPError::NonDigit},
+            {"1970315123 45", CNPError::NonDigit},
+            {"1970315123:45", CNPError::NonDigit},                     // Just above '9'
+            {"1970315123/45", CNPError::NonDigit},                     // Just below '0'
+            {"1970315123\xff" "45", CNPError::NonDigit},               // Negative as a signed byte
+            {withChecksum("097031512345"), CNPError::Sex},
+            {withChecksum("197131512345"), CNPError::Month},
+            {withChecksum("197033212345"), CNPError::Day},             // 32 March
+            {withChecksum("197022912345"), CNPError::Day},             // 1970 is not a leap year
+            {withChecksum("197031500345"), CNPError::County},
+            {withChecksum("197031553345"), CNPError::County},
+            {bad_checksum, CNPError::Checksum},
+        };
+    }
+
+    // Random 13-character records, mostly digits, sometimes valid
+    std::string randomRecord(std::mt19937& rng) {
+        std::uniform_int_distribution<int> digit(0, 9);
+        std::uniform_int_distribution<int> percent(0, 99);
+        std::string digits;
+        for (int i = 0; i < 12; i++) digits += static_cast<char>('0' + digit(rng));
+        if (percent(rng) < 30) {
+            // Plausible date and county, so the checksum decides
+            digits[3] = '0'; digits[4] = static_cast<char>('1' + digit(rng) % 9);
+            digits[5] = '1'; digits[6] = static_cast<char>('0' + digit(rng));
+            digits[7] = '2'; digits[8] = static_cast<char>('0' + digit(rng));
+        }
+        std::string cnp = percent(rng) < 50 ? withChecksum(digits) : digits + static_cast<char>('0' + digit(rng));
+        if (percent(rng) < 10) cnp[percent(rng) % 13] = static_cast<char>(percent(rng) < 50 ? 'x' : 0x80 + digit(rng));
+        return cnp;
+    }
+}
+
+int main() {
+    // Every sample is classified as expected by the scalar validator
+    for (const auto& [cnp, expected] : samples()) {
+        CHECK(CNPValidator::validate(cnp).error == expected);
+    }
+
+    // Each sample alone and at every position of batches of every length
+    // mod 16, so it goes through both the SSE2 loop and the scalar tail
+    std::vector<std::pair<std::string, CNPError>> all = samples();
+    std::mt19937 rng(7);
+    for (std::size_t length = 1; length <= 48; length++) {
+        for (std::size_t shift = 0; shift < all.size(); shift++) {
+            std::vector<std::string> batch;
+            std::vector<CNPError> expected;
+            for (std::size_t i = 0; i < length; i++) {
+                const auto& [cnp, error] = all[(i + shift) % all.size()];
+                batch.push_back(cnp);
+                expected.push_back(error);
+            }
+            CHECK(CNPValidator::validateBatch(batch) == expected);
+        }
+    }
+
+    // Random records through the packed interface, for every count mod 16
+    for (std::size_t count = 0; count <= 64; count++) {
+        std::vector<std::string> records;
+        std::string packed;
+        for (std::size_t i = 0; i < count; i++) {
+            records.push_back(randomRecord(rng));
+            packed += records.back();
+        }
+
+        std::vector<CNPError> errors(count, CNPError::Length);
+        CNPValidator::validateBatch(packed.data(), count, errors.data());
+        for (std::size_t i = 0; i < count; i++) {
+            CHECK(errors[i] == CNPValidator::validate(records[i]).error);
+        }
+    }
+
+    return checkResult("cnp_validation");
+}
@@ -0,0 +1,61 @@
+// Weighted fair share: with equal backlogs, a brand of weight 2 is ordered
+// twice as often as a brand of weight 1. Unregistered brands get no share.
+
+#include "Check.hpp"
+#include "TestService.hpp"
+#include "SchedulingPolicy.hpp"
+
+int main() {
+    FairSharePolicy policy;
+    policy.setWeight("WeightHeavy", 2.0);
+    policy.setWeight("WeightLight", 1.0);
+
+    // Twelve requests per brand, all of one brand first so ids alone would
+    // serve it exclusively
+    RepairRequestFactory factory(1);
+    std::vector<std::unique_ptr<RepairRequest>> requests;
+    std::vector<RepairRequest*> pending;
+    for (const char* brand : {"WeightHeavy", "WeightLight"}) {
+        for (int i = 0; i < 12; i++) {
+            requests.push_back(factory.createRepairRequest(
+                ApplianceFactory::createApplianceFridge(brand, "Model", 2020, 1000, true), 1, 1, 1));
+            pending.push_back(requests.back().get());
+        }
+    }
+
+    policy.order(pending);
+    CHECK(pending.size() == 24);
+
+    // Every prefix of the order splits about 2:1
+    int heavy = 0;
+    for (std::size_t i = 0; i < 18; i++) {
+        if (pending[i]->getAppliance().getBrand() == "WeightHeavy") heavy++;
+        int served = static_cast<int>(i) + 1;
+        CHECK(heavy * 3 >= served * 2 - 3 && heavy * 3 <= served * 2 + 3);
+    }
+    CHECK(heavy == 12);
+
+    // Assignments move the tags by 1 / weight, so the split holds across ticks
+    for (std::size_t i = 0; i < 6; i++) policy.onAssigned(*pending[i]);
+    pending.erase(pending.begin(), pending.begin() + 6);
+    policy.order(pending);
+    heavy = 0;
+    for (std::size_t i = 0; i < 6; i++) {
+        if (pending[i]->getAppliance().getBrand() == "WeightHeavy") heavy++;
+    }
+    CHECK(heavy == 4);
+
+    // A brand nobody registered has no share: it is ordered last and its
+    // assignment leaves the other brands' tags alone
+    auto stray = factory.createRepairRequest(
+        ApplianceFactory::createApplianceFridge("WeightNeverStored", "Model", 2020, 1000, true), 1, 1, 1);
+    CHECK(stray->getAppliance().getBrandId() == Appliance::UNREGISTERED_BRAND);
+    pending.insert(pending.begin(), stray.get());
+    policy.order(pending);
+    CHECK(pending.size() == 19);
+    CHECK(pending.back() == stray.get());
+    policy.onAssigned(*stray);
+    CHECK(stray->getAppliance().getBrandId() == Appliance::UNREGISTERED_BRAND);
+
+    return checkResult("fair_share_weights");
+}
@@ -29,7 +29,10 @@ int main() {
     tech_ptr->addSkill(ApplianceType::Fridge, "Samsung");
     tech_ptr->addSkill(ApplianceType::TV, "LG");
     
-    manager.addEmployee(std::move(tech1));
+    if (!manager.addEmployee(std::move(tech1))) {
+        std::cerr << "Technician was rejected (ID or CNP already in use)\n";
+        return 1;
+    }
     
     // Add some repair requests
     auto fridge = ApplianceFactory::createApplianceFridge(
@@ -56,6 +59,10 @@ int main() {
     ServiceManager& newManager = ServiceManager::getInstance();
     RepairRequestFactory newRequestFactory(1);
     
+    // The manager is a singleton: without this, every saved employee would be
+    // rejected as a duplicate and the load reported as incomplete
+    newManager.clear();
+    
     // Load data from CSV files
     if (newManager.loadFromCSV(newRequestFactory, "Employees.csv", "RepairRequests.csv")) {
         std::cout << "All data loaded successfully!\n";
@@ -0,0 +1,76 @@
+// Skill bitsets, the planning queries built on them, and brand registration:
+// only stored requests and learned skills may add brands to the registry.
+
+#include "Check.hpp"
+#include "TestService.hpp"
+#include "BrandRegistry.hpp"
+
+#include <algorithm>
+
+namespace {
+    bool sameTechnicians(std::vector<const Technician*> got, std::vector<const Technician*> expected) {
+        std::sort(got.begin(), got.end());
+        std::sort(expected.begin(), expected.end());
+        return got == expected;
+    }
+}
+
+int main() {
+    ServiceManager& manager = ServiceManager::getInstance();
+    manager.clear();
+
+    Technician* fridges_and_tvs = hireTechnician(manager, {{ApplianceType::Fridge, "CovSamsung"},
+                                                           {ApplianceType::TV, "CovLG"}});
+    Technician* fridges = hireTechnician(manager, {{ApplianceType::Fridge, "CovSamsung"}});
+    Technician* washers = hireTechnician(manager, {{ApplianceType::WashingMachine, "CovBosch"}});
+    CHECK(fridges_and_tvs && fridges && washers);
+
+    // Covering all of a set vs. any of it
+    SkillSet fridge_and_tv;
+    fridge_and_tv.add(ApplianceType::Fridge, "CovSamsung");
+    fridge_and_tv.add(ApplianceType::TV, "CovLG");
+    CHECK(sameTechnicians(manager.getTechniciansCoveringAll(fridge_and_tv), {fridges_and_tvs}));
+    CHECK(sameTechnicians(manager.getTechniciansCoveringAny(fridge_and_tv), {fridges_and_tvs, fridges}));
+
+    SkillSet washer_and_tv;
+    washer_and_tv.add(ApplianceType::WashingMachine, "CovBosch");
+    washer_and_tv.add(ApplianceType::TV, "CovLG");
+    CHECK(manager.getTechniciansCoveringAll(washer_and_tv).empty());
+    CHECK(sameTechnicians(manager.getTechniciansCoveringAny(washer_and_tv), {fridges_and_tvs, washers}));
+
+    // The same brand under another type is a different skill
+    SkillSet samsung_tv;
+    samsung_tv.add(ApplianceType::TV, "CovSamsung");
+    CHECK(manager.getTechniciansCoveringAny(samsung_tv).empty());
+
+    // Everyone covers nothing, nobody covers any of nothing
+    SkillSet nothing;
+    CHECK(manager.getTechniciansCoveringAll(nothing).size() == 3);
+    CHECK(manager.getTechniciansCoveringAny(nothing).empty());
+
+    // Building an appliance does not register its brand
+    std::size_t brands = BrandRegistry::size();
+    auto unseen = ApplianceFactory::createApplianceFridge("CovNeverStored", "Model", 2020, 1000, true);
+    CHECK(unseen->getBrandId() == Appliance::UNREGISTERED_BRAND);
+    CHECK(!fridges->canRepair(*unseen));
+    CHECK(!BrandRegistry::find("CovNeverStored"));
+    unseen.reset();
+    CHECK(BrandRegistry::size() == brands);
+
+    // An appliance built before a technician learned its brand still resolves it
+    auto later = ApplianceFactory::createApplianceFridge("CovLearnedLater", "Model", 2020, 1000, true);
+    CHECK(!fridges->canRepair(*later));
+    fridges->addSkill(ApplianceType::Fridge, "CovLearnedLater");
+    CHECK(fridges->canRepair(*later));
+    CHECK(later->getBrandId() == *BrandRegistry::find("CovLearnedLater"));
+
+    // Storing a request registers its brand
+    RepairRequestFactory factory(1);
+    int receptionist = hireReceptionist(manager);
+    addPendingRequest(manager, factory, receptionist, "CovStored");
+    CHECK(BrandRegistry::find("CovStored").has_value());
+    CHECK(BrandRegistry::size() == brands + 2);
+
+    manager.clear();
+    return checkResult("skill_coverage");
+}